@@ -23,6 +23,19 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eCU_TYPE.h"
 #include "eCU_BSTFPRV.h"
+#include "eCU_BSTFCFG.h"
+#include "eCU_CIRQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Lenght of the CRC 32 trailer appended to the payload when the CRC mode is enabled */
+#define ECU_BSTF_CRCL                                                                                ( ( uint32_t ) 4u )
+
+/* Max dimension of a stuffed frame with a payload of p_uDataL byte: every payload byte escaped, plus SOF and EOF */
+#define ECU_BSTF_MAXSTUFFL(p_uDataL)                                     ( ( 2u * ( ( uint32_t ) ( p_uDataL ) ) ) + 2u )
 
 
 
@@ -38,15 +51,32 @@ typedef enum
     e_eCU_BSTF_RES_FRAMEENDED,
     e_eCU_BSTF_RES_NOINITLIB,
     e_eCU_BSTF_RES_NOINITFRAME,
+    e_eCU_BSTF_RES_OUTOFMEM,
 }e_eCU_BSTF_RES;
 
+typedef struct
+{
+    const uint8_t* puData;
+    uint32_t       uDataL;
+}t_eCU_BSTF_Seg;
+
 typedef struct
 {
     bool_t   bIsInit;
 	uint8_t* puBuff;
 	uint32_t uBuffL;
+    const uint8_t* puFrame;
     uint32_t uFrameL;
 	uint32_t uFrameCtr;
+    bool_t   bCrcEn;
+    uint32_t uCrc;
+    uint8_t  auCrc[ECU_BSTF_CRCL];
+    const t_eCU_BSTF_Seg* ptSeg;
+    const uint8_t* puSeg;
+    uint32_t uSegN;
+    uint32_t uSegIdx;
+    uint32_t uSegStart;
+    const t_eCU_BSTFCFG_Ctx* ptCfg;
     e_eCU_BSTFPRV_SM eSM;
 }t_eCU_BSTF_Ctx;
 
@@ -94,6 +124,40 @@ e_eCU_BSTF_RES eCU_BSTF_IsInit(t_eCU_BSTF_Ctx* const p_ptCtx, bool_t* p_pbIsInit
  */
 e_eCU_BSTF_RES eCU_BSTF_GetWherePutData(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puMaxL);
 
+/**
+ * @brief       Enable or disable the CRC mode. When enabled the CRC 32 (see eCU_CRC_32) of the payload is calculated
+ *              while the payload is stuffed, and is appended after the payload, in big endian and stuffed, before the
+ *              EOF. In the worst case a stuffed frame will be ECU_BSTF_MAXSTUFFL( p_uDataL + ECU_BSTF_CRCL ) byte.
+ *              Calling this function discharge the current frame, so a new frame must be started after it.
+ *
+ * @param[in]   p_ptCtx      - Byte stuffer context
+ * @param[in]   p_bCrcEn     - true to enable the CRC mode, false to disable it
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_BSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_BSTF_RES eCU_BSTF_SetCrcMode(t_eCU_BSTF_Ctx* const p_ptCtx, const bool_t p_bCrcEn);
+
+/**
+ * @brief       Use a different set of delimiter and escape transformation (see eCU_BSTFCFG.h), like the one of SLIP or
+ *              asynchronous HDLC. Without calling this function the stuffer use ECU_SOF, ECU_EOF, ECU_ESC and the
+ *              bitwise not, and calling eCU_BSTF_InitCtx restore this default. The configuration is not copied, so it
+ *              must be valid until the context is used. Calling this function discharge the current frame, so a new
+ *              frame must be started after it.
+ *
+ * @param[in]   p_ptCtx      - Byte stuffer context
+ * @param[in]   p_ptCfg      - Initialized delimiter configuration
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_BSTF_RES_BADPARAM      - The configuration is not initialized
+ *		        e_eCU_BSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_BSTF_RES eCU_BSTF_SetCfg(t_eCU_BSTF_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg);
+
 /**
  * @brief       Start to stuff a new frame given the dimension of raw payload it self. This function suppouse that
  *              data payload that need to be stuffed were already copied in memory.( see eCU_BSTF_GetWherePutData
@@ -110,6 +174,44 @@ e_eCU_BSTF_RES eCU_BSTF_GetWherePutData(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t**
  */
 e_eCU_BSTF_RES eCU_BSTF_NewFrame(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p_uFrameL);
 
+/**
+ * @brief       Start to stuff a new frame taking the raw payload directly from a memory area owned by the caller,
+ *              without copying it in the context buffer. The memory area must not be modified until the frame is
+ *              completely stuffed or a new frame is started. After this call every other function (restart, get
+ *              remaining, get chunk) will work on the external payload.
+ *
+ * @param[in]   p_ptCtx      - Byte stuffer context
+ * @param[in]   p_puFrame    - Pointer to the raw payload that we need to stuff
+ * @param[in]   p_uFrameL    - lenght of the raw data present in p_puFrame
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eCU_BSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_BSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_BSTF_RES eCU_BSTF_NewFrameExt(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puFrame, const uint32_t p_uFrameL);
+
+/**
+ * @brief       Start to stuff a new frame whose raw payload is split in more memory areas owned by the caller, for
+ *              example an header, a payload and a CRC. Segments are stuffed one after the other as a single payload,
+ *              and the stuffed chunk can be retrived with the usual functions. The array of segments and every memory
+ *              area it points must not be modified until the frame is completely stuffed or a new frame is started.
+ *              Segments of zero lenght are allowed, but the sum of every segment lenght must not be zero.
+ *
+ * @param[in]   p_ptCtx      - Byte stuffer context
+ * @param[in]   p_ptSeg      - Pointer to an array of segments that describe the raw payload
+ * @param[in]   p_uSegN      - Number of segments present in p_ptSeg
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eCU_BSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_BSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_BSTF_RES eCU_BSTF_NewFrameSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const t_eCU_BSTF_Seg* p_ptSeg,
+                                    const uint32_t p_uSegN);
+
 /**
  * @brief       Restart to stuff the already passed data/the current frame
  *
@@ -167,6 +269,78 @@ e_eCU_BSTF_RES eCU_BSTF_GetRemByteToGet(t_eCU_BSTF_Ctx* const p_ptCtx, uint32_t*
 e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_puStuffedBuf, const uint32_t p_uMaxBufL,
                                      uint32_t* const p_puGettedL);
 
+/**
+ * @brief       Retrive stuffed data chunk directly in the free space of a circular queue, without an intermediate
+ *              buffer. The stuffed data is written in both the contiguous free area of the queue when the free space
+ *              wrap, and the function stop when the queue is full or when the frame is ended. When the queue is full
+ *              the function can be called again, after some data is retrived from the queue, to continue the frame.
+ *
+ * @param[in]   p_ptCtx        - Byte stuffer context
+ * @param[in]   p_ptCirq       - Initialized circular queue where stuffed data will be inserted
+ * @param[out]  p_puGettedL    - Pointer to an uint32_t were we will store the number stuffed data inserted in the
+ *                               queue
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_NOINITLIB     - Need to init the data stuffer context or the circular queue before
+ *                                             taking some action
+ *		        e_eCU_BSTF_RES_BADPARAM      - The circular queue refused the stuffed data
+ *		        e_eCU_BSTF_RES_NOINITFRAME   - Need to start a frame before retriving data
+ *		        e_eCU_BSTF_RES_CORRUPTCTX    - In case of an corrupted context of the stuffer or of the queue
+ *              e_eCU_BSTF_RES_FRAMEENDED    - The last stuffed byte of the frame is inserted in the queue, or the
+ *                                             frame was already ended
+ *              e_eCU_BSTF_RES_OK            - The queue is full and the frame is not ended yet
+ */
+e_eCU_BSTF_RES eCU_BSTF_GetStufChunkCirq(t_eCU_BSTF_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* const p_ptCirq,
+                                         uint32_t* const p_puGettedL);
+
+/**
+ * @brief       Stuff a whole frame in a single call, without using any context. Use this function when the complete
+ *              payload is already in memory. Sizing p_puStuffedBuf with ECU_BSTF_MAXSTUFFL( p_uDataL ) byte will
+ *              guarantee that e_eCU_BSTF_RES_OUTOFMEM is never returned.
+ *
+ * @param[in]   p_puData       - Pointer to the raw payload that we want to stuff
+ * @param[in]   p_uDataL       - Lenght of the raw payload
+ * @param[out]  p_puStuffedBuf - Pointer to the destination area where the stuffed frame will be placed
+ * @param[in]   p_uMaxBufL     - Max fillable size of the destination area
+ * @param[out]  p_puStuffedL   - Pointer to an uint32_t were we will store the lenght of the stuffed frame
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_BSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eCU_BSTF_RES_OUTOFMEM      - The destination area is too small for the stuffed frame
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly, the full frame is in p_puStuffedBuf
+ */
+e_eCU_BSTF_RES eCU_BSTF_StuffBuf(const uint8_t* p_puData, const uint32_t p_uDataL, uint8_t* p_puStuffedBuf,
+                                 const uint32_t p_uMaxBufL, uint32_t* const p_puStuffedL);
+
+/**
+ * @brief       Stuff many whole frames in a single call, without using any context, placing them one after the other
+ *              in the destination area. Use this function to send a lot of small payload already in memory, because
+ *              the validation of the parameter is done only one time for all the frames. When the destination area is
+ *              full the frames that are complete are reported, and the remaining ones can be stuffed with another
+ *              call starting from &p_ptFrame[*p_puStuffedN]. Sizing p_puStuffedBuf with the sum of
+ *              ECU_BSTF_MAXSTUFFL( uDataL ) of every frame will guarantee that e_eCU_BSTF_RES_OUTOFMEM is never
+ *              returned.
+ *
+ * @param[in]   p_ptFrame      - Array of p_uFrameN payload, every payload is stuffed in a different frame
+ * @param[in]   p_uFrameN      - Number of payload
+ * @param[out]  p_puStuffedBuf - Pointer to the destination area where the stuffed frames will be placed
+ * @param[in]   p_uMaxBufL     - Max fillable size of the destination area
+ * @param[out]  p_puFrameOff   - Array of p_uFrameN uint32_t were we will store the offset of every stuffed frame in
+ *                               p_puStuffedBuf. A frame end where the next one start, or at p_puStuffedL.
+ * @param[out]  p_puStuffedN   - Pointer to an uint32_t were we will store the number of frame completely stuffed
+ * @param[out]  p_puStuffedL   - Pointer to an uint32_t were we will store the lenght of the stuffed frames
+ *
+ * @return      e_eCU_BSTF_RES_BADPOINTER    - In case of bad pointer passed to the function, or a payload with a
+ *                                             NULL pointer. Frames before the payload are stuffed anyway.
+ *		        e_eCU_BSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function, or an empty
+ *                                             payload. Frames before the payload are stuffed anyway.
+ *		        e_eCU_BSTF_RES_OUTOFMEM      - The destination area is too small for every stuffed frame, only
+ *                                             p_puStuffedN frames are stuffed
+ *              e_eCU_BSTF_RES_OK            - Operation ended correctly, every frame is in p_puStuffedBuf
+ */
+e_eCU_BSTF_RES eCU_BSTF_StuffBatch(const t_eCU_BSTF_Seg* p_ptFrame, const uint32_t p_uFrameN, uint8_t* p_puStuffedBuf,
+                                   const uint32_t p_uMaxBufL, uint32_t* const p_puFrameOff,
+                                   uint32_t* const p_puStuffedN, uint32_t* const p_puStuffedL);
+
 
 
 #ifdef __cplusplus
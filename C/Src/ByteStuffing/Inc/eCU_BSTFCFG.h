@@ -0,0 +1,165 @@
+/**
+ * @file       eCU_BSTFCFG.h
+ *
+ * @brief      Byte stuffer delimiter configuration. Describe the SOF, EOF and ESC byte and how a byte is transformed
+ *             after the ESC, so the byte stuffer and unstuffer can talk with peers that use a different framing, like
+ *             SLIP or asynchronous HDLC. Every byte is classified using a 256 entry lookup table.
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_BSTFCFG_H
+#define ECU_BSTFCFG_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Number of entry of the classification and transformation tables, one for every byte value */
+#define ECU_BSTFCFG_TABLEL                                                                         ( ( uint32_t ) 256u )
+
+/* Bit of the classification table */
+#define ECU_BSTFCFG_CLASS_SOF                                                                      ( ( uint8_t ) 0x01u )
+#define ECU_BSTFCFG_CLASS_EOF                                                                      ( ( uint8_t ) 0x02u )
+#define ECU_BSTFCFG_CLASS_ESC                                                                      ( ( uint8_t ) 0x04u )
+#define ECU_BSTFCFG_CLASS_STUFF                                                                    ( ( uint8_t ) 0x08u )
+#define ECU_BSTFCFG_CLASS_ESCVAL                                                                   ( ( uint8_t ) 0x10u )
+/* Byte accepted after ESC by the unstuffer even if it's not the transformation of a stuffed byte ( HDLC only ) */
+#define ECU_BSTFCFG_CLASS_RXVAL                                                                    ( ( uint8_t ) 0x20u )
+
+/* SLIP ( RFC 1055 ) framing */
+#define ECU_BSTFCFG_SLIP_END                                                                       ( ( uint8_t ) 0xC0u )
+#define ECU_BSTFCFG_SLIP_ESC                                                                       ( ( uint8_t ) 0xDBu )
+#define ECU_BSTFCFG_SLIP_ESCEND                                                                    ( ( uint8_t ) 0xDCu )
+#define ECU_BSTFCFG_SLIP_ESCESC                                                                    ( ( uint8_t ) 0xDDu )
+
+/* Asynchronous HDLC ( RFC 1662 ) framing */
+#define ECU_BSTFCFG_HDLC_FLAG                                                                      ( ( uint8_t ) 0x7Eu )
+#define ECU_BSTFCFG_HDLC_ESC                                                                       ( ( uint8_t ) 0x7Du )
+#define ECU_BSTFCFG_HDLC_XOR                                                                       ( ( uint8_t ) 0x20u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_BSTFCFG_RES_OK = 0,
+    e_eCU_BSTFCFG_RES_BADPARAM,
+    e_eCU_BSTFCFG_RES_BADPOINTER,
+    e_eCU_BSTFCFG_RES_NOINITLIB,
+}e_eCU_BSTFCFG_RES;
+
+typedef struct
+{
+    bool_t  bIsInit;
+    uint8_t uSof;
+    uint8_t uEof;
+    uint8_t uEsc;
+    uint8_t uXorMask;
+    uint8_t auClass[ECU_BSTFCFG_TABLEL];
+    uint8_t auXform[ECU_BSTFCFG_TABLEL];
+}t_eCU_BSTFCFG_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize a delimiter configuration where a stuffed byte is sent as ESC followed by the byte xored
+ *              with p_uXorMask. A mask of 0xFF is the bitwise not used by the default configuration, a mask of 0x20 is
+ *              the one used by HDLC. SOF and EOF can be the same byte, like the flag of HDLC. SOF, EOF and ESC are
+ *              always stuffed, other byte can be added with eCU_BSTFCFG_AddStuffByte.
+ *
+ * @param[in]   p_ptCtx       - Delimiter configuration context
+ * @param[in]   p_uSof        - Start of frame byte
+ * @param[in]   p_uEof        - End of frame byte
+ * @param[in]   p_uEsc        - Escape byte
+ * @param[in]   p_uXorMask    - Mask used to transform the byte after the ESC
+ *
+ * @return      e_eCU_BSTFCFG_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BSTFCFG_RES_BADPARAM     - ESC equal to SOF or EOF, mask equal to zero or a transformed byte that
+ *                                               is a delimiter
+ *              e_eCU_BSTFCFG_RES_OK           - Operation ended correctly
+ */
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitCtx(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uSof, const uint8_t p_uEof,
+                                      const uint8_t p_uEsc, const uint8_t p_uXorMask);
+
+/**
+ * @brief       Initialize an asynchronous HDLC configuration: flag 0x7E used as SOF and EOF, escape 0x7D and xor 0x20.
+ *              Control character can be added to the stuffed byte using eCU_BSTFCFG_AddStuffByte. Like requested by
+ *              RFC 1662 the unstuffer accept every byte after the escape and xor it with 0x20, even if the byte was
+ *              not added to the stuffed byte of this configuration.
+ *
+ * @param[in]   p_ptCtx       - Delimiter configuration context
+ *
+ * @return      e_eCU_BSTFCFG_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *              e_eCU_BSTFCFG_RES_OK           - Operation ended correctly
+ */
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitHdlc(t_eCU_BSTFCFG_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Initialize a SLIP configuration: END 0xC0 used as SOF and EOF, ESC 0xDB, END sent as ESC ESC_END and
+ *              ESC sent as ESC ESC_ESC. SLIP doesn't define how to transform other byte, so eCU_BSTFCFG_AddStuffByte
+ *              can't be used with this configuration.
+ *
+ * @param[in]   p_ptCtx       - Delimiter configuration context
+ *
+ * @return      e_eCU_BSTFCFG_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *              e_eCU_BSTFCFG_RES_OK           - Operation ended correctly
+ */
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitSlip(t_eCU_BSTFCFG_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx       - Delimiter configuration context
+ * @param[out]  p_pbIsInit    - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eCU_BSTFCFG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_BSTFCFG_RES_OK            - Operation ended correctly
+ */
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_IsInit(t_eCU_BSTFCFG_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Add a byte that will be stuffed by the byte stuffer even if it's not a delimiter, like the control
+ *              character of the HDLC async control character map. Must be called before passing the configuration to
+ *              the stuffer and unstuffer.
+ *
+ * @param[in]   p_ptCtx       - Delimiter configuration context
+ * @param[in]   p_uByte       - Byte that must be stuffed
+ *
+ * @return      e_eCU_BSTFCFG_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BSTFCFG_RES_NOINITLIB    - Need to init the configuration before taking some action
+ *		        e_eCU_BSTFCFG_RES_BADPARAM     - The configuration doesn't use a xor transformation, or the byte or its
+ *                                               transformation collide with a byte already used by the configuration
+ *              e_eCU_BSTFCFG_RES_OK           - Operation ended correctly
+ */
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_AddStuffByte(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uByte);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_BSTFCFG_H */
\ No newline at end of file
@@ -23,6 +23,16 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eCU_TYPE.h"
 #include "eCU_BUNSTFPRV.h"
+#include "eCU_BSTFCFG.h"
+#include "eCU_CIRQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Lenght of the CRC 32 trailer present at the end of the payload when the CRC mode is enabled */
+#define ECU_BUNSTF_CRCL                                                                              ( ( uint32_t ) 4u )
 
 
 
@@ -40,14 +50,33 @@ typedef enum
 	e_eCU_BUNSTF_RES_FRAMEENDED,
     e_eCU_BUNSTF_RES_FRAMERESTART,
     e_eCU_BUNSTF_RES_NOINITLIB,
+    e_eCU_BUNSTF_RES_CLBCKREPORTERROR,
 }e_eCU_BUNSTF_RES;
 
+/* Define a generic frame callback context that must be implemented by the user */
+typedef struct t_eCU_BUNSTF_FrameCtxUser t_eCU_BUNSTF_FrameCtx;
+
+/* Call back of a function that will receive every frame found by eCU_BUNSTF_InsStufChunkMulti. p_eFrameRes is
+ * e_eCU_BUNSTF_RES_FRAMEENDED for a correctly received frame, e_eCU_BUNSTF_RES_BADFRAME for a bad formed frame and
+ * e_eCU_BUNSTF_RES_OUTOFMEM for a frame bigger than the unstuffer memory. p_puFrame point to the internal memory of the
+ * unstuffer, so data must be copied before returning. Returning false will stop the parsing of the chunk.
+ * the p_ptCtx parameter is a custom pointer that can be used by the creator of this callback, and will not be used
+ * by the unstuffer module */
+typedef bool_t (*f_eCU_BUNSTF_FrameCb) ( t_eCU_BUNSTF_FrameCtx* const p_ptCtx, const e_eCU_BUNSTF_RES p_eFrameRes,
+                                         const uint8_t* p_puFrame, const uint32_t p_uFrameL );
+
 typedef struct
 {
     bool_t   bIsInit;
 	uint8_t* puBuff;
 	uint32_t uBuffL;
 	uint32_t uFrameCtr;
+    bool_t   bCrcEn;
+    uint32_t uCrc;
+    const t_eCU_BSTFCFG_Ctx* ptCfg;
+    bool_t   bHuntEn;
+    uint32_t uSkipL;
+    bool_t   bEndIsSof;
 	e_eCU_BUNSTFPRV_SM eSM;
 }t_eCU_BUNSTF_Ctx;
 
@@ -81,7 +110,9 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_InitCtx(t_eCU_BUNSTF_Ctx* const p_ptCtx, uint8_t* p_
 e_eCU_BUNSTF_RES eCU_BUNSTF_IsInit(t_eCU_BUNSTF_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
 /**
- * @brief       Start receiving a new frame, loosing the previous stored unstuffed frame
+ * @brief       Start receiving a new frame, loosing the previous stored unstuffed frame. When the previous frame
+ *              was ended or discharged by a delimiter that is both SOF and EOF, like in SLIP and HDLC, that delimiter
+ *              is also the start of the new frame, so the new frame will start directly with the data.
  *
  * @param[in]   p_ptCtx         - Byte unStuffer context
  *
@@ -92,6 +123,71 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_IsInit(t_eCU_BUNSTF_Ctx* const p_ptCtx, bool_t* p_pb
  */
 e_eCU_BUNSTF_RES eCU_BUNSTF_NewFrame(t_eCU_BUNSTF_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Enable or disable the CRC mode. When enabled every frame must end with the CRC 32 (see eCU_CRC_32) of
+ *              the payload in big endian, as generated by the byte stuffer in CRC mode. The CRC is calculated while the
+ *              data is unstuffed and is verified when the EOF is received: a frame with a wrong CRC is reported as a
+ *              bad frame, and for a good frame the unstuffed lenght will not include the ECU_BUNSTF_CRCL byte of
+ *              the trailer. The context memory must be able to hold the payload plus the trailer. Calling this
+ *              function discharge the current frame, like eCU_BUNSTF_NewFrame.
+ *
+ * @param[in]   p_ptCtx         - Byte unStuffer context
+ * @param[in]   p_bCrcEn        - true to enable the CRC mode, false to disable it
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetCrcMode(t_eCU_BUNSTF_Ctx* const p_ptCtx, const bool_t p_bCrcEn);
+
+/**
+ * @brief       Use a different set of delimiter and escape transformation (see eCU_BSTFCFG.h), that must be the same
+ *              used by the byte stuffer of the peer. Without calling this function the unstuffer use ECU_SOF, ECU_EOF,
+ *              ECU_ESC and the bitwise not, and calling eCU_BUNSTF_InitCtx restore this default. When SOF and EOF are
+ *              the same byte, like in SLIP and HDLC, a delimiter received when no data is unstuffed is considered a
+ *              start of frame, so consecutive delimiter are not reported as bad frame. The configuration is not
+ *              copied, so it must be valid until the context is used. Calling this function discharge the current
+ *              frame, like eCU_BUNSTF_NewFrame.
+ *
+ * @param[in]   p_ptCtx         - Byte unStuffer context
+ * @param[in]   p_ptCfg         - Initialized delimiter configuration
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTF_RES_BADPARAM     - The configuration is not initialized
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetCfg(t_eCU_BUNSTF_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg);
+
+/**
+ * @brief       Enable or disable the hunt mode. Without hunt mode a byte different from the SOF received while waiting
+ *              the start of frame is a bad frame. In hunt mode eCU_BUNSTF_InsStufChunk discharge every byte until a
+ *              SOF is found or the chunk is finished, and the number of discharged byte is added to the skipped
+ *              counter. The current frame is not changed.
+ * @param[in]   p_ptCtx         - Byte unStuffer context
+ * @param[in]   p_bHuntEn       - true to enable the hunt mode, false to disable it
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetHuntMode(t_eCU_BUNSTF_Ctx* const p_ptCtx, const bool_t p_bHuntEn);
+
+/**
+ * @brief       Retrive the number of byte discharged while waiting a start of frame, by the hunt mode and by
+ *              eCU_BUNSTF_InsStufChunkMulti, since the initialization of the context. Useful to monitor the quality
+ *              of the line.
+ * @param[in]   p_ptCtx       - Byte unStuffer context
+ * @param[out]  p_puSkipL     - Pointer to a uint32_t variable where the number of skipped byte will be placed
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_GetSkippedL(t_eCU_BUNSTF_Ctx* const p_ptCtx, uint32_t* const p_puSkipL);
+
 /**
  * @brief       Retrive the pointer to the stored unstuffed data, and the data size of the frame. Keep in mind that
  *              the frame parsing could be ongoing, and that value could change.
@@ -206,6 +302,129 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_IsFrameBad(const t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t*
 e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunk(t_eCU_BUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
                                          const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL);
 
+/**
+ * @brief       Insert the stuffed data present in a circular queue, like eCU_BUNSTF_InsStufChunk but without copying
+ *              the data out of the queue. The data is unstuffed directly from the occupied area of the queue, both
+ *              before and after the wrap, and only the analized data is removed from the queue. Data not analized
+ *              because the frame ended, restarted or is bad formed is left in the queue, so it will be analized by
+ *              the next call without any other action.
+ * @param[in]   p_ptCtx           - Byte unStuffer context
+ * @param[in]   p_ptCirq          - Initialized circular queue containing the stuffed data
+ * @param[out]  p_puConsumedBufL  - Pointer to an uint32_t were we will store how many stuffed data byte has been
+ *                                  analized and removed from the queue
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB    - The unstuffer or the circular queue is not initialized
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX   - The unstuffer or the circular queue context is corrupted
+ *		        e_eCU_BUNSTF_RES_BADPARAM     - The circular queue can't be used or the analized data can't be removed
+ *              e_eCU_BUNSTF_RES_OK           - The queue is empty and the frame is not finished yet
+ *              Every other value is returned like eCU_BUNSTF_InsStufChunk
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunkCirq(t_eCU_BUNSTF_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* const p_ptCirq,
+                                             uint32_t* const p_puConsumedBufL);
+
+/**
+ * @brief       Insert a stuffed data chunk that can contain any number of frames. Every frame found in the chunk is
+ *              passed to p_fFrameCb, and after the callback the unstuffer is automatically ready to receive the next
+ *              frame, so there is no need to call eCU_BUNSTF_NewFrame. A frame not yet ended is kept in the context
+ *              and will be completed by the next call. While waiting for the start of a frame every byte different
+ *              from SOF is discharged without reporting an error. After a bad frame or a frame too big for the
+ *              unstuffer memory, the remaining data of the frame are discharged until a new SOF is received.
+ *              When SOF and EOF are the same byte, like in SLIP and HDLC, the flag that close a frame is also the
+ *              start of the next one, so frames separated by a single flag are all received.
+ *              If the context was left with an ended or bad frame by eCU_BUNSTF_InsStufChunk, that frame is discharged
+ *              before starting.
+ *
+ * @param[in]   p_ptCtx           - Byte unStuffer context
+ * @param[in]   p_puStuffBuf      - Pointer to the stuffed Data that we will unstuff
+ * @param[in]   p_uStuffBufL      - Size of the p_puStuffBuf
+ * @param[in]   p_fFrameCb        - Callback called for every ended, bad or too big frame
+ * @param[in]   p_ptFrameCbCtx    - Custom context passed to the callback function p_fFrameCb
+ * @param[out]  p_puConsumedBufL  - Pointer to an uint32_t were we will store how many stuffed data byte has been
+ *                                  analized. Will be lower than p_uStuffBufL only if the callback return false or
+ *                                  some other error is returned.
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_NOINITLIB        - Need to init context before taking some action
+ *		        e_eCU_BUNSTF_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eCU_BUNSTF_RES_CORRUPTCTX       - In case of an corrupted context
+ *		        e_eCU_BUNSTF_RES_CLBCKREPORTERROR - The callback returned false, the parsing is stopped after the
+ *                                                  frame passed to the callback
+ *              e_eCU_BUNSTF_RES_OK               - All the chunk is parsed, every frame found is passed to the
+ *                                                  callback
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunkMulti(t_eCU_BUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, f_eCU_BUNSTF_FrameCb p_fFrameCb,
+                                              t_eCU_BUNSTF_FrameCtx* const p_ptFrameCbCtx,
+                                              uint32_t* const p_puConsumedBufL);
+
+/**
+ * @brief       Unstuff a whole frame in a single call, without using any context. p_puStuffBuf must contain exactly
+ *              one stuffed frame: a SOF, the stuffed payload and an EOF. Sizing p_puData with p_uStuffBufL - 2 byte
+ *              will guarantee that e_eCU_BUNSTF_RES_OUTOFMEM is never returned.
+ *
+ * @param[in]   p_puStuffBuf      - Pointer to the stuffed frame that we will unstuff
+ * @param[in]   p_uStuffBufL      - Size of the stuffed frame
+ * @param[out]  p_puData          - Pointer to the destination area where the unstuffed payload will be placed
+ * @param[in]   p_uMaxDataL       - Max fillable size of the destination area
+ * @param[out]  p_puDataL         - Pointer to an uint32_t were we will store the lenght of the unstuffed payload
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *              e_eCU_BUNSTF_RES_OUTOFMEM     - The destination area is too small for the unstuffed payload
+ *              e_eCU_BUNSTF_RES_BADFRAME     - p_puStuffBuf doesn't contain a single valid frame
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_UnstuffBuf(const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL, uint8_t* p_puData,
+                                       const uint32_t p_uMaxDataL, uint32_t* const p_puDataL);
+
+/**
+ * @brief       Unstuff the first frame present in p_puBuf writing the unstuffed payload over the stuffed data itself,
+ *              without using any context or other memory. The payload is never longer than the stuffed data, so it's
+ *              placed starting from the byte after the SOF and the stuffed data is overwritten only after being
+ *              analized. Data before the first SOF is skipped, and data after the EOF is not modified, so the
+ *              function can be called again from p_puConsumedL to unstuff the next frame. The stuffed frame is lost
+ *              even when the function return an error. Works only with the default delimiter ECU_SOF, ECU_EOF and
+ *              ECU_ESC.
+ *
+ * @param[in]   p_puBuf           - Pointer to the stuffed data, overwritten with the unstuffed payload
+ * @param[in]   p_uBufL           - Size of the stuffed data
+ * @param[out]  p_puDataOff       - Pointer to an uint32_t were we will store the offset of the unstuffed payload in
+ *                                  p_puBuf
+ * @param[out]  p_puDataL         - Pointer to an uint32_t were we will store the lenght of the unstuffed payload
+ * @param[out]  p_puConsumedL     - Pointer to an uint32_t were we will store how many byte has been analized. When
+ *                                  a SOF is found inside the frame it's not analized, so the next call restart
+ *                                  from it.
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *              e_eCU_BUNSTF_RES_BADFRAME     - No SOF found, or the frame is bad formed, empty or without EOF
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_UnstuffInPlace(uint8_t* p_puBuf, const uint32_t p_uBufL, uint32_t* const p_puDataOff,
+                                           uint32_t* const p_puDataL, uint32_t* const p_puConsumedL);
+
+/**
+ * @brief       Split a long stuffed stream in p_uNSeg segment that can be unstuffed independently, for example by
+ *              different context or different thread, without using any context. A SOF can't be present in a stuffed
+ *              payload, so every segment after the first one start with a SOF, and a frame is never divided between
+ *              two segment. Segment i go from p_puSegStart[i] to p_puSegStart[i + 1] ( or to p_uStuffBufL for the
+ *              last one ), and is empty when the two value are equals. Unstuffing the segment in order, for example
+ *              with eCU_BUNSTF_InsStufChunkMulti, will give the same frames of unstuffing the whole stream. Works
+ *              only with the default delimiter ECU_SOF, ECU_EOF and ECU_ESC.
+ *
+ * @param[in]   p_puStuffBuf      - Pointer to the stuffed stream
+ * @param[in]   p_uStuffBufL      - Size of the stuffed stream
+ * @param[out]  p_puSegStart      - Pointer to an array of p_uNSeg uint32_t were we will store the offset of the
+ *                                  start of every segment. The first one is always zero.
+ * @param[in]   p_uNSeg           - Number of segment
+ *
+ * @return      e_eCU_BUNSTF_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTF_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *              e_eCU_BUNSTF_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTF_RES eCU_BUNSTF_SplitAtSof(const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL,
+                                       uint32_t* const p_puSegStart, const uint32_t p_uNSeg);
+
 
 
 #ifdef __cplusplus
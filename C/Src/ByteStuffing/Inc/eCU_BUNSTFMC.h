@@ -0,0 +1,214 @@
+/**
+ * @file       eCU_BUNSTFMC.h
+ *
+ * @brief      Multi channel byte unstuffer utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_BUNSTFMC_H
+#define ECU_BUNSTFMC_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+#include "eCU_BUNSTF.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Minimum size of a frame buffer of the pool, a free buffer is used to store the index of the next free buffer */
+#define ECU_BUNSTFMC_MINFRAMEL                                                                       ( ( uint32_t ) 4u )
+
+/* Index used when a channel doesn't own a frame buffer, or when the pool has no more free buffer */
+#define ECU_BUNSTFMC_NOBUFF                                                                 ( ( uint32_t ) 0xFFFFFFFFu )
+
+/* Maximum number of frame buffer of the pool, every buffer has a bit telling if it's owned by the caller */
+#define ECU_BUNSTFMC_MAXBUFF                                                                        ( ( uint32_t ) 64u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_BUNSTFMC_RES_OK = 0,
+    e_eCU_BUNSTFMC_RES_BADPARAM,
+    e_eCU_BUNSTFMC_RES_BADPOINTER,
+	e_eCU_BUNSTFMC_RES_CORRUPTCTX,
+    e_eCU_BUNSTFMC_RES_OUTOFMEM,
+    e_eCU_BUNSTFMC_RES_BADFRAME,
+	e_eCU_BUNSTFMC_RES_FRAMEENDED,
+    e_eCU_BUNSTFMC_RES_NOFREEBUFF,
+    e_eCU_BUNSTFMC_RES_NOINITLIB,
+}e_eCU_BUNSTFMC_RES;
+
+/* Pool of frame buffer shared by every channel */
+typedef struct
+{
+    bool_t   bIsInit;
+	uint8_t* puPool;
+	uint32_t uFrameL;
+	uint32_t uNBuff;
+    uint32_t uFreeHead;
+    uint32_t uNFree;
+    uint8_t  auUserOwn[ECU_BUNSTFMC_MAXBUFF / 8u];
+    const t_eCU_BSTFCFG_Ctx* ptCfg;
+}t_eCU_BUNSTFMC_Ctx;
+
+/* State of a single stream, a frame buffer is owned only between the SOF and the end of the frame */
+typedef struct
+{
+	uint32_t uBuffIdx;
+	uint32_t uFrameCtr;
+	e_eCU_BUNSTFPRV_SM eSM;
+}t_eCU_BUNSTFMC_Chan;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the multi channel unstuffer context. The memory area is divided in frame buffer of
+ *              p_uFrameL byte, that are given to a channel only while a frame is received on it. At most
+ *              ECU_BUNSTFMC_MAXBUFF frame buffer can be present in the memory area.
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[in]   p_puPool      - Pointer to a memory area that we will use to store the unstuffed frames
+ * @param[in]   p_uPoolL      - Dimension in byte of the memory area
+ * @param[in]   p_uFrameL     - Maximum dimension of an unstuffed frame, at least ECU_BUNSTFMC_MINFRAMEL
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_BADPARAM     - In case of an invalid parameter passed to the function, or if the
+ *                                                memory area contains more than ECU_BUNSTFMC_MAXBUFF frame buffer
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InitCtx(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, uint8_t* p_puPool, const uint32_t p_uPoolL,
+                                        const uint32_t p_uFrameL);
+
+/**
+ * @brief       Check if the lib is initialized
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[out]  p_pbIsInit    - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_BUNSTFMC_RES_OK            - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_IsInit(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Use a different set of delimiter instead of the default one, see eCU_BUNSTF_SetCfg. The same
+ *              configuration is shared by every channel of the context. The configuration is not copied, so it must be
+ *              valid until the context is used, and must be set before inserting data in any channel.
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[in]   p_ptCfg       - Initialized delimiter configuration
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_BADPARAM     - The configuration is not initialized
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_SetCfg(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg);
+
+/**
+ * @brief       Initialize a channel, that will wait for a start of frame without owning any frame buffer. Must be
+ *              called only on a channel that doesn't own a frame buffer, use eCU_BUNSTFMC_CloseChan otherwise.
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[in]   p_ptChan      - Channel to initialize
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InitChan(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan);
+
+/**
+ * @brief       Discharge the frame that is currently received on the channel, giving back his frame buffer to the
+ *              pool. The channel can be used again and will wait for a new start of frame.
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[in]   p_ptChan      - Channel to close
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context or channel
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_CloseChan(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan);
+
+/**
+ * @brief       Insert a stuffed data chunk received on a channel. A frame buffer is taken from the pool when a start
+ *              of frame is found, and when the frame is ended the buffer itself is returned, without any copy. The
+ *              returned frame is owned by the caller until it's given back with eCU_BUNSTFMC_RelFrame. When SOF and
+ *              EOF are the same byte, the flag that close a frame is also the start of the next one: a new frame
+ *              buffer is taken immediately, or if the pool is empty the flag is not analized and must be passed again.
+ * @param[in]   p_ptCtx           - Multi channel unstuffer context
+ * @param[in]   p_ptChan          - Channel where the data is received
+ * @param[in]   p_puStuffBuf      - Pointer to the stuffed Data that we will unstuff
+ * @param[in]   p_uStuffBufL      - Size of the p_puStuffBuf
+ * @param[out]  p_puConsumedBufL  - Pointer to an uint32_t were we will store how many stuffed data byte has been
+ *                                  analized. Unalized data must be passed again in another call.
+ * @param[out]  p_ppuFrame        - Pointer to a Pointer filled with the frame buffer when the frame is ended
+ * @param[out]  p_puFrameL        - Pointer to an uint32_t filled with the size of the frame when the frame is ended
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context or channel
+ *		        e_eCU_BUNSTFMC_RES_FRAMEENDED   - A frame is received and returned in p_ppuFrame and p_puFrameL
+ *              e_eCU_BUNSTFMC_RES_BADFRAME     - A bad formed frame is discharged, and his buffer is back in the pool
+ *              e_eCU_BUNSTFMC_RES_OUTOFMEM     - A frame bigger than p_uFrameL is discharged, and his buffer is back
+ *                                                in the pool
+ *              e_eCU_BUNSTFMC_RES_NOFREEBUFF   - A start of frame is found but every frame buffer is in use. Data
+ *                                                starting from the start of frame is not analized, and must be passed
+ *                                                again after releasing some frame.
+ *              e_eCU_BUNSTFMC_RES_OK           - Every data is analized, and the frame is not finished yet
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InsStufChunk(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan,
+                                             const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL,
+                                             uint32_t* const p_puConsumedBufL, uint8_t** p_ppuFrame,
+                                             uint32_t* const p_puFrameL);
+
+/**
+ * @brief       Give back to the pool a frame returned by eCU_BUNSTFMC_InsStufChunk. Every frame must be released only
+ *              one time, releasing it again is refused.
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[in]   p_puFrame     - Frame returned by eCU_BUNSTFMC_InsStufChunk
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_BADPARAM     - The pointer is not a frame buffer of the pool, or the frame buffer
+ *                                                is not owned by the caller: already released, free or still used
+ *                                                by a channel
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_RelFrame(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint8_t* p_puFrame);
+
+/**
+ * @brief       Retrive the number of frame buffer that are not used by any channel or by the caller
+ * @param[in]   p_ptCtx       - Multi channel unstuffer context
+ * @param[out]  p_puNFree     - Pointer to a uint32_t variable where the number of free buffer will be placed
+ * @return      e_eCU_BUNSTFMC_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_BUNSTFMC_RES_NOINITLIB    - Need to init context before taking some action
+ *		        e_eCU_BUNSTFMC_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_BUNSTFMC_RES_OK           - Operation ended correctly
+ */
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_GetFreeBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, uint32_t* const p_puNFree);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_BUNSTFMC_H */
\ No newline at end of file
@@ -0,0 +1,197 @@
+/**
+ * @file       eCU_CSTF.h
+ *
+ * @brief      COBS byte stuffer utils. Consistent Overhead Byte Stuffing encode the payload in blocks that never
+ *             contain the 0x00 value, so 0x00 can be used as end of frame. Every block start with a code byte, and
+ *             the overhead is at most one byte every 254 byte of payload, plus the end of frame.
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CSTF_H
+#define ECU_CSTF_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+#include "eCU_CSTFPRV.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Value used as end of frame, it never appear in the stuffed data */
+#define ECU_CSTF_EOF                                                                               ( ( uint8_t ) 0x00u )
+
+/* Max number of payload byte that a single block can contain */
+#define ECU_CSTF_MAXBLOCKL                                                                         ( ( uint32_t ) 254u )
+
+/* Max dimension of a stuffed frame with a payload of p_uDataL byte: one code every 254 byte, plus the end of frame */
+#define ECU_CSTF_MAXSTUFFL(p_uDataL)   ( ( ( uint32_t ) ( p_uDataL ) ) + ( ( ( uint32_t ) ( p_uDataL ) ) / 254u ) + 2u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_CSTF_RES_OK = 0,
+    e_eCU_CSTF_RES_BADPARAM,
+    e_eCU_CSTF_RES_BADPOINTER,
+	e_eCU_CSTF_RES_CORRUPTCTX,
+    e_eCU_CSTF_RES_FRAMEENDED,
+    e_eCU_CSTF_RES_NOINITLIB,
+    e_eCU_CSTF_RES_NOINITFRAME,
+}e_eCU_CSTF_RES;
+
+typedef struct
+{
+    bool_t   bIsInit;
+	uint8_t* puBuff;
+	uint32_t uBuffL;
+    uint32_t uFrameL;
+	uint32_t uFrameCtr;
+    uint32_t uBlockRem;
+    bool_t   bBlockFull;
+    e_eCU_CSTFPRV_SM eSM;
+}t_eCU_CSTF_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the COBS byte stuffer context
+ *
+ * @param[in]   p_ptCtx    - COBS byte stuffer context
+ * @param[in]   p_puBuff   - Pointer to a memory area that we will use to store data that needs to be stuffed
+ * @param[in]   p_uBuffL   - Dimension in byte of the memory area
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_InitCtx(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx       - COBS byte stuffer context
+ * @param[out]  p_pbIsInit    - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_IsInit(t_eCU_CSTF_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Retrive the pointer of the buffer that the user can use to insert data payload that need to be stuffed
+ *
+ * @param[in]   p_ptCtx    - COBS byte stuffer context
+ * @param[out]  p_ppuData  - Pointer to a Pointer where the raw data needs to be copied before starting a frame
+ * @param[out]  p_puMaxL   - Pointer to a uint32_t variable where the max number of data that can be copied in
+ *                           p_ppuData will be placed
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_CSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_GetWherePutData(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puMaxL);
+
+/**
+ * @brief       Start to stuff a new frame given the dimension of raw payload it self. This function suppouse that
+ *              data payload that need to be stuffed were already copied in memory.( see eCU_CSTF_GetWherePutData
+ *              in order to know how get the data pointer )
+ *
+ * @param[in]   p_ptCtx      - COBS byte stuffer context
+ * @param[in]   p_uFrameL    - lenght of the raw data present in the frame that we need to stuff
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eCU_CSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_CSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_NewFrame(t_eCU_CSTF_Ctx* const p_ptCtx, const uint32_t p_uFrameL);
+
+/**
+ * @brief       Restart to stuff the already passed data/the current frame
+ *
+ * @param[in]   p_ptCtx         - COBS byte stuffer context
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_CSTF_RES_NOINITFRAME   - Need to start a frame before restarting the current frame
+ *		        e_eCU_CSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_RestartFrame(t_eCU_CSTF_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the numbers of stuffed bytes that can be retrived using eCU_CSTF_GetStufChunk (e.g. if the
+ *              value of the returned value is zero it's means that the frame is ended ).
+ *
+ * @param[in]   p_ptCtx       - COBS byte stuffer context
+ * @param[out]  p_puGettedL   - Pointer to a uint32_t variable where the numbers of retrivable stuffed data will be
+ *                              placed
+ *
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_CSTF_RES_NOINITFRAME   - Need to start a frame before getting how many stuffed data we can retrive
+ *		        e_eCU_CSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly
+ */
+e_eCU_CSTF_RES eCU_CSTF_GetRemByteToGet(t_eCU_CSTF_Ctx* const p_ptCtx, uint32_t* const p_puGettedL);
+
+/**
+ * @brief       Retrive stuffed data chunk. The raw data copied in the buffer retrived using the function
+ *              eCU_CSTF_GetWherePutData will be stuffed and retrived by this function. The frame is terminated by
+ *              ECU_CSTF_EOF.
+ *
+ * @param[in]   p_ptCtx        - COBS byte stuffer context
+ * @param[in]   p_puStuffedBuf - Pointer to the destination area where stuffed data will be placed by this function
+ * @param[in]   p_uMaxBufL     - Max fillable size of the destination area
+ * @param[out]  p_puGettedL    - Pointer to an uint32_t were we will store the number stuffed data inserted in
+ *                               p_puStuffedBuf. Note that if the function return e_eCU_CSTF_RES_OK the value of
+ *                               filledLen will be equals to p_uMaxBufL. The value filledLen infact could be lower
+ *                               than max dest size only if some error is returned or if the frame is
+ *                               ended ( e_eCU_CSTF_RES_FRAMEENDED ).
+ * @return      e_eCU_CSTF_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eCU_CSTF_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eCU_CSTF_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eCU_CSTF_RES_NOINITFRAME   - Need to start a frame before retriving data
+ *		        e_eCU_CSTF_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eCU_CSTF_RES_FRAMEENDED    - No more data that we can elaborate, restart or start a new frame to
+ *                                             proceed. This means that we have finished stuffing the current frame.
+ *                                             Keep in mind in this case that the value of filledLen could be lower
+ *                                             than p_uMaxBufL.
+ *              e_eCU_CSTF_RES_OK            - Operation ended correctly. This dosent mean that the stuffing process is
+ *                                             completed, but we can be sure that filledLen will have the same value of
+ *                                             p_uMaxBufL
+ */
+e_eCU_CSTF_RES eCU_CSTF_GetStufChunk(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t* p_puStuffedBuf, const uint32_t p_uMaxBufL,
+                                     uint32_t* const p_puGettedL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CSTF_H */
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+ * @file       eCU_CSTFPRV.h
+ *
+ * @brief      COBS byte stuffer utils private definition
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CSTFPRV_H
+#define ECU_CSTFPRV_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_CSTFPRV_SM_NEEDCODE = 0,
+    e_eCU_CSTFPRV_SM_NEEDDATA,
+    e_eCU_CSTFPRV_SM_NEEDEOF,
+    e_eCU_CSTFPRV_SM_STUFFEND
+}e_eCU_CSTFPRV_SM;
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CSTFPRV_H */
\ No newline at end of file
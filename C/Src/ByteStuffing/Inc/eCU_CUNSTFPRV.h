@@ -0,0 +1,40 @@
+/**
+ * @file       eCU_CUNSTFPRV.h
+ *
+ * @brief      COBS byte unstuffer utils private definition
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CUNSTFPRV_H
+#define ECU_CUNSTFPRV_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_CUNSTFPRV_SM_NEEDCODE = 0,
+    e_eCU_CUNSTFPRV_SM_NEEDDATA,
+    e_eCU_CUNSTFPRV_SM_UNSTUFFEND,
+    e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL
+}e_eCU_CUNSTFPRV_SM;
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CUNSTFPRV_H */
\ No newline at end of file
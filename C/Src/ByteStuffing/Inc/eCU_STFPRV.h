@@ -0,0 +1,179 @@
+/**
+ * @file       eCU_STFPRV.h
+ *
+ * @brief      Byte scan utils private definition, shared by every stuffer and unstuffer
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_STFPRV_H
+#define ECU_STFPRV_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Constant used to search a byte value in four byte at the same time ( SWAR, SIMD within a register ) */
+#define ECU_STFPRV_SWARLSB                                                                  ( ( uint32_t ) 0x01010101u )
+#define ECU_STFPRV_SWARMSB                                                                  ( ( uint32_t ) 0x80808080u )
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE INLINE FUNCTION
+ **********************************************************************************************************************/
+/**
+ * @brief       Check if at least one byte of a word is zero, using ( x - 0x01.. ) & ~x & 0x80..
+ *
+ * @param[in]   p_uWord     - Four byte to check
+ *
+ * @return      true if at least one byte is zero, false otherwise
+ */
+static inline bool_t eCU_STFPRV_HasZeroByte(const uint32_t p_uWord)
+{
+    return ( 0u != ( ( p_uWord - ECU_STFPRV_SWARLSB ) & ( ~p_uWord ) & ECU_STFPRV_SWARMSB ) );
+}
+
+/**
+ * @brief       Check if at least one byte of a word is equal to a value, a byte equal to the value become zero after
+ *              the xor
+ *
+ * @param[in]   p_uWord     - Four byte to check
+ * @param[in]   p_uByte     - Value to search
+ *
+ * @return      true if at least one byte is equal to p_uByte, false otherwise
+ */
+static inline bool_t eCU_STFPRV_HasByte(const uint32_t p_uWord, const uint8_t p_uByte)
+{
+    return eCU_STFPRV_HasZeroByte( p_uWord ^ ( ECU_STFPRV_SWARLSB * ( uint32_t ) p_uByte ) );
+}
+
+/**
+ * @brief       Retrive how many byte can be read before finding a zero byte. Four byte are checked for every
+ *              iteration, and only the last word is checked one byte at a time.
+ *
+ * @param[in]   p_puData    - Data to scan
+ * @param[in]   p_uMaxL     - Max number of byte to scan
+ *
+ * @return      Number of non zero byte before the first zero, p_uMaxL if no zero is present
+ */
+static inline uint32_t eCU_STFPRV_GetNonZeroRunL(const uint8_t* p_puData, const uint32_t p_uMaxL)
+{
+    /* Local variable */
+    uint32_t l_uRunL;
+    uint32_t l_uWord;
+    bool_t l_bFound;
+
+    l_uRunL = 0u;
+    l_bFound = false;
+
+    while( ( ( p_uMaxL - l_uRunL ) >= sizeof(uint32_t) ) && ( false == l_bFound ) )
+    {
+        (void)memcpy(&l_uWord, &p_puData[l_uRunL], sizeof(uint32_t));
+
+        if( true == eCU_STFPRV_HasZeroByte(l_uWord) )
+        {
+            l_bFound = true;
+        }
+        else
+        {
+            l_uRunL += sizeof(uint32_t);
+        }
+    }
+
+    /* Find the exact position of the zero byte or check the remaining byte */
+    l_bFound = false;
+    while( ( l_uRunL < p_uMaxL ) && ( false == l_bFound ) )
+    {
+        if( 0u == p_puData[l_uRunL] )
+        {
+            l_bFound = true;
+        }
+        else
+        {
+            l_uRunL++;
+        }
+    }
+
+    return l_uRunL;
+}
+
+/**
+ * @brief       Retrive how many byte can be read before finding one of the three delimiter. Four byte are checked
+ *              for every iteration, and only the last word is checked one byte at a time.
+ *
+ * @param[in]   p_puData    - Data to scan
+ * @param[in]   p_uMaxL     - Max number of byte to scan
+ * @param[in]   p_uSof      - Start of frame value
+ * @param[in]   p_uEof      - End of frame value
+ * @param[in]   p_uEsc      - Escape value
+ *
+ * @return      Number of byte before the first delimiter, p_uMaxL if no delimiter is present
+ */
+static inline uint32_t eCU_STFPRV_GetNonDelimRunL(const uint8_t* p_puData, const uint32_t p_uMaxL,
+                                                  const uint8_t p_uSof, const uint8_t p_uEof, const uint8_t p_uEsc)
+{
+    /* Local variable */
+    uint32_t l_uRunL;
+    uint32_t l_uWord;
+    bool_t l_bFound;
+
+    l_uRunL = 0u;
+    l_bFound = false;
+
+    while( ( ( p_uMaxL - l_uRunL ) >= sizeof(uint32_t) ) && ( false == l_bFound ) )
+    {
+        (void)memcpy(&l_uWord, &p_puData[l_uRunL], sizeof(uint32_t));
+
+        if( ( true == eCU_STFPRV_HasByte(l_uWord, p_uSof) ) || ( true == eCU_STFPRV_HasByte(l_uWord, p_uEof) ) ||
+            ( true == eCU_STFPRV_HasByte(l_uWord, p_uEsc) ) )
+        {
+            l_bFound = true;
+        }
+        else
+        {
+            l_uRunL += sizeof(uint32_t);
+        }
+    }
+
+    /* Find the exact position of the delimiter or check the remaining byte */
+    l_bFound = false;
+    while( ( l_uRunL < p_uMaxL ) && ( false == l_bFound ) )
+    {
+        if( ( p_uSof == p_puData[l_uRunL] ) || ( p_uEof == p_puData[l_uRunL] ) || ( p_uEsc == p_puData[l_uRunL] ) )
+        {
+            l_bFound = true;
+        }
+        else
+        {
+            l_uRunL++;
+        }
+    }
+
+    return l_uRunL;
+}
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_STFPRV_H */
\ No newline at end of file
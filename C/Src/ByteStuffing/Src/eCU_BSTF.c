@@ -11,6 +11,8 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eCU_BSTF.h"
+#include "eCU_CRC.h"
+#include "eCU_STFPRV.h"
 
 
 
@@ -18,6 +20,19 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eCU_BSTF_IsStatusStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx);
+static e_eCU_BSTF_RES eCU_BSTF_ConvertCirqRes(const e_eCU_CIRQ_RES p_eCirqRes);
+static bool_t eCU_BSTF_IsSegStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx);
+static uint32_t eCU_BSTF_GetRawRunL(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData, const uint32_t p_uMaxL);
+static bool_t eCU_BSTF_IsStuffByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte);
+static uint8_t eCU_BSTF_XformByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte);
+static uint32_t eCU_BSTF_GetSegL(const t_eCU_BSTF_Ctx* p_ptCtx, const uint32_t p_uSegIdx);
+static void eCU_BSTF_SetSingleSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puFrame);
+static uint32_t eCU_BSTF_GetTotL(const t_eCU_BSTF_Ctx* p_ptCtx);
+static const uint8_t* eCU_BSTF_NextSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p_uSegIdx, const uint32_t p_uCrc,
+                                       uint8_t* p_puCrcBuf);
+static void eCU_BSTF_UpdateCrc(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL);
+static e_eCU_BSTF_RES eCU_BSTF_StuffOne(const uint8_t* p_puData, const uint32_t p_uDataL, uint8_t* p_puStuffedBuf,
+                                        const uint32_t p_uMaxBufL, uint32_t* const p_puStuffedL);
 
 
 
@@ -47,6 +62,9 @@ e_eCU_BSTF_RES eCU_BSTF_InitCtx(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_puBuff
             p_ptCtx->bIsInit = true;
             p_ptCtx->puBuff = p_puBuff;
             p_ptCtx->uBuffL = p_uBuffL;
+            eCU_BSTF_SetSingleSeg(p_ptCtx, p_puBuff);
+            p_ptCtx->bCrcEn = false;
+            p_ptCtx->ptCfg = NULL;
             p_ptCtx->uFrameL = 0u;
             p_ptCtx->uFrameCtr = 0u;
             p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
@@ -114,6 +132,96 @@ e_eCU_BSTF_RES eCU_BSTF_GetWherePutData(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t**
 	return l_eRes;
 }
 
+e_eCU_BSTF_RES eCU_BSTF_SetCrcMode(t_eCU_BSTF_Ctx* const p_ptCtx, const bool_t p_bCrcEn)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Discharge the current frame, the trailer change the frame lenght */
+                eCU_BSTF_SetSingleSeg(p_ptCtx, p_ptCtx->puBuff);
+                p_ptCtx->bCrcEn = p_bCrcEn;
+                p_ptCtx->uFrameL = 0u;
+                p_ptCtx->uFrameCtr = 0u;
+                p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
+
+                l_eRes = e_eCU_BSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTF_RES eCU_BSTF_SetCfg(t_eCU_BSTF_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCfg ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity */
+                if( false == p_ptCfg->bIsInit )
+                {
+                    l_eRes = e_eCU_BSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Discharge the current frame, the stuffed byte could be different */
+                    eCU_BSTF_SetSingleSeg(p_ptCtx, p_ptCtx->puBuff);
+                    p_ptCtx->ptCfg = p_ptCfg;
+                    p_ptCtx->uFrameL = 0u;
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
+
+                    l_eRes = e_eCU_BSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eCU_BSTF_RES eCU_BSTF_NewFrame(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p_uFrameL)
 {
 	/* Local variable */
@@ -141,15 +249,18 @@ e_eCU_BSTF_RES eCU_BSTF_NewFrame(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p
             else
             {
                 /* Check param validity */
-                if( ( p_uFrameL <= 0u ) || ( p_uFrameL > p_ptCtx->uBuffL ) )
+                if( ( p_uFrameL <= 0u ) || ( p_uFrameL > p_ptCtx->uBuffL ) ||
+                    ( ( true == p_ptCtx->bCrcEn ) && ( p_uFrameL > ( 0xFFFFFFFFu - ECU_BSTF_CRCL ) ) ) )
                 {
                     l_eRes = e_eCU_BSTF_RES_BADPARAM;
                 }
                 else
                 {
                     /* Update data */
+                    eCU_BSTF_SetSingleSeg(p_ptCtx, p_ptCtx->puBuff);
                     p_ptCtx->uFrameL = p_uFrameL;
                     p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
                     p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
 
                     l_eRes = e_eCU_BSTF_RES_OK;
@@ -161,6 +272,138 @@ e_eCU_BSTF_RES eCU_BSTF_NewFrame(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p
 	return l_eRes;
 }
 
+e_eCU_BSTF_RES eCU_BSTF_NewFrameExt(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puFrame, const uint32_t p_uFrameL)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrame ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity, the payload is not in our buffer so no limit on its size */
+                if( ( p_uFrameL <= 0u ) ||
+                    ( ( true == p_ptCtx->bCrcEn ) && ( p_uFrameL > ( 0xFFFFFFFFu - ECU_BSTF_CRCL ) ) ) )
+                {
+                    l_eRes = e_eCU_BSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Update data */
+                    eCU_BSTF_SetSingleSeg(p_ptCtx, p_puFrame);
+                    p_ptCtx->uFrameL = p_uFrameL;
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+                    p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
+
+                    l_eRes = e_eCU_BSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTF_RES eCU_BSTF_NewFrameSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const t_eCU_BSTF_Seg* p_ptSeg,
+                                    const uint32_t p_uSegN)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+    uint32_t l_uFrameL;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptSeg ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check every segment and calculate the whole payload lenght */
+                l_uFrameL = 0u;
+                l_uIdx = 0u;
+                l_eRes = e_eCU_BSTF_RES_OK;
+
+                while( ( l_uIdx < p_uSegN ) && ( e_eCU_BSTF_RES_OK == l_eRes ) )
+                {
+                    if( NULL == p_ptSeg[l_uIdx].puData )
+                    {
+                        l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+                    }
+                    else if( p_ptSeg[l_uIdx].uDataL > ( 0xFFFFFFFFu - l_uFrameL ) )
+                    {
+                        l_eRes = e_eCU_BSTF_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        l_uFrameL += p_ptSeg[l_uIdx].uDataL;
+                    }
+
+                    l_uIdx++;
+                }
+
+                if( e_eCU_BSTF_RES_OK == l_eRes )
+                {
+                    /* Check param validity */
+                    if( ( l_uFrameL <= 0u ) ||
+                        ( ( true == p_ptCtx->bCrcEn ) && ( l_uFrameL > ( 0xFFFFFFFFu - ECU_BSTF_CRCL ) ) ) )
+                    {
+                        l_eRes = e_eCU_BSTF_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Update data, start from the first segment */
+                        p_ptCtx->puFrame = p_ptSeg[0u].puData;
+                        p_ptCtx->puSeg = p_ptSeg[0u].puData;
+                        p_ptCtx->uFrameL = l_uFrameL;
+                        p_ptCtx->uFrameCtr = 0u;
+                        p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+                        p_ptCtx->ptSeg = p_ptSeg;
+                        p_ptCtx->uSegN = p_uSegN;
+                        p_ptCtx->uSegIdx = 0u;
+                        p_ptCtx->uSegStart = 0u;
+                        p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eCU_BSTF_RES eCU_BSTF_RestartFrame(t_eCU_BSTF_Ctx* const p_ptCtx)
 {
 	/* Local variable */
@@ -196,8 +439,14 @@ e_eCU_BSTF_RES eCU_BSTF_RestartFrame(t_eCU_BSTF_Ctx* const p_ptCtx)
                 {
                     /* Update index */
                     p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
                     p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDSOF;
 
+                    /* Go back to the first segment */
+                    p_ptCtx->puSeg = p_ptCtx->puFrame;
+                    p_ptCtx->uSegIdx = 0u;
+                    p_ptCtx->uSegStart = 0u;
+
                     l_eRes = e_eCU_BSTF_RES_OK;
                 }
             }
@@ -213,6 +462,12 @@ e_eCU_BSTF_RES eCU_BSTF_GetRemByteToGet(t_eCU_BSTF_Ctx* const p_ptCtx, uint32_t*
 	e_eCU_BSTF_RES l_eRes;
     uint32_t l_uCalLen;
 	uint32_t l_uIndx;
+    uint32_t l_uSegIdx;
+    uint32_t l_uSegOff;
+    const uint8_t* l_puSeg;
+    uint8_t l_uCurB;
+    uint32_t l_uCrc;
+    uint8_t l_auCrc[ECU_BSTF_CRCL];
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_puGettedL ) )
@@ -250,7 +505,7 @@ e_eCU_BSTF_RES eCU_BSTF_GetRemByteToGet(t_eCU_BSTF_Ctx* const p_ptCtx, uint32_t*
                     }
                     else if( e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA == p_ptCtx->eSM )
                     {
-                        /* If a precedent byte of the payload was an SOF, EOF or ESC character, this means that the
+                        /* If a precedent byte of the payload was a stuffed character, this means that the
                         * ESC char is already inserted in the unstuffed data, but that we need to add the negation of
                         * the payload + the EOF */
                         l_uCalLen = 2u;
@@ -269,35 +524,29 @@ e_eCU_BSTF_RES eCU_BSTF_GetRemByteToGet(t_eCU_BSTF_Ctx* const p_ptCtx, uint32_t*
 
                     /* Calculate the remaining byte from the current counter of course */
 					l_uIndx = p_ptCtx->uFrameCtr;
-                    while( ( l_uIndx < p_ptCtx->uFrameL ) && ( l_uCalLen < 0xFFFFFFFFu ) )
+                    l_uSegIdx = p_ptCtx->uSegIdx;
+                    l_uSegOff = p_ptCtx->uFrameCtr - p_ptCtx->uSegStart;
+                    l_puSeg = p_ptCtx->puSeg;
+                    l_uCrc = p_ptCtx->uCrc;
+                    while( ( l_uIndx < eCU_BSTF_GetTotL(p_ptCtx) ) && ( l_uCalLen < 0xFFFFFFFFu ) )
                     {
-                        if( ECU_SOF == p_ptCtx->puBuff[l_uIndx] )
+                        /* Move to the next segment when the current one is ended */
+                        while( l_uSegOff >= eCU_BSTF_GetSegL(p_ptCtx, l_uSegIdx) )
                         {
-							/* Try to avoid overflow. Resonable limit for HW */
-							if( l_uCalLen <= 0xFFFFFFFDu )
-							{
-								/* Stuff with escape */
-								l_uCalLen += 2u;
-							}
-							else
-							{
-								l_uCalLen = 0xFFFFFFFFu;
-							}
+                            l_uSegIdx++;
+                            l_uSegOff = 0u;
+                            l_puSeg = eCU_BSTF_NextSeg(p_ptCtx, l_uSegIdx, l_uCrc, l_auCrc);
                         }
-                        else if( ECU_EOF == p_ptCtx->puBuff[l_uIndx] )
+
+                        l_uCurB = l_puSeg[l_uSegOff];
+
+                        /* The CRC trailer can't be known without calculating the CRC of the remaining payload */
+                        if( ( true == p_ptCtx->bCrcEn ) && ( l_uSegIdx < p_ptCtx->uSegN ) )
                         {
-							/* Try to avoid overflow. Resonable limit for HW */
-							if( l_uCalLen <= 0xFFFFFFFDu )
-							{
-								/* Stuff with escape */
-								l_uCalLen += 2u;
-							}
-							else
-							{
-								l_uCalLen = 0xFFFFFFFFu;
-							}
+                            (void)eCU_CRC_32Seed(l_uCrc, &l_uCurB, 1u, &l_uCrc);
                         }
-                        else if( ECU_ESC == p_ptCtx->puBuff[l_uIndx] )
+
+                        if( true == eCU_BSTF_IsStuffByte(p_ptCtx->ptCfg, l_uCurB) )
                         {
 							/* Try to avoid overflow. Resonable limit for HW */
 							if( l_uCalLen <= 0xFFFFFFFDu )
@@ -317,6 +566,7 @@ e_eCU_BSTF_RES eCU_BSTF_GetRemByteToGet(t_eCU_BSTF_Ctx* const p_ptCtx, uint32_t*
                         }
 
 						l_uIndx++;
+                        l_uSegOff++;
                     }
 
                     /* Copy calc value */
@@ -337,24 +587,26 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
 	/* Local variable */
 	e_eCU_BSTF_RES l_eRes;
     uint32_t l_uNFillB;
+    uint32_t l_uRunL;
+    uint32_t l_uSegOff;
     uint8_t l_uPrecB;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puStuffedBuf ) || ( NULL == p_puGettedL ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puStuffedBuf ) || ( NULL == p_puGettedL ) ) )
 	{
 		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
             }
@@ -388,7 +640,8 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
                                 case e_eCU_BSTFPRV_SM_NEEDSOF :
                                 {
                                     /* Start of frame */
-                                    p_puStuffedBuf[l_uNFillB] = ECU_SOF;
+                                    p_puStuffedBuf[l_uNFillB] = ( ( NULL == p_ptCtx->ptCfg ) ? ECU_SOF :
+                                                                                             p_ptCtx->ptCfg->uSof );
                                     l_uNFillB++;
                                     p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDRAWDATA;
 
@@ -397,44 +650,50 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
 
                                 case e_eCU_BSTFPRV_SM_NEEDRAWDATA :
                                 {
-                                    if( p_ptCtx->uFrameCtr >= p_ptCtx->uFrameL )
+                                    l_uSegOff = p_ptCtx->uFrameCtr - p_ptCtx->uSegStart;
+                                    if( p_ptCtx->uFrameCtr >= eCU_BSTF_GetTotL(p_ptCtx) )
                                     {
                                         /* End of frame needed */
                                         p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDEOF;
                                     }
+                                    else if( l_uSegOff >= eCU_BSTF_GetSegL(p_ptCtx, p_ptCtx->uSegIdx) )
+                                    {
+                                        /* Current segment ended, continue with the next one or with the CRC */
+                                        p_ptCtx->uSegStart += eCU_BSTF_GetSegL(p_ptCtx, p_ptCtx->uSegIdx);
+                                        p_ptCtx->uSegIdx++;
+                                        p_ptCtx->puSeg = eCU_BSTF_NextSeg(p_ptCtx, p_ptCtx->uSegIdx, p_ptCtx->uCrc,
+                                                                            p_ptCtx->auCrc);
+                                    }
                                     else
                                     {
                                         /* Parse data from the frame now */
-                                        if( ECU_SOF == p_ptCtx->puBuff[p_ptCtx->uFrameCtr] )
+                                        if( true == eCU_BSTF_IsStuffByte(p_ptCtx->ptCfg, p_ptCtx->puSeg[l_uSegOff]) )
                                         {
                                             /* Stuff with escape */
-                                            p_puStuffedBuf[l_uNFillB] = ECU_ESC;
-                                            p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA;
-                                            l_uNFillB++;
-                                            p_ptCtx->uFrameCtr++;
-                                        }
-                                        else if( ECU_EOF == p_ptCtx->puBuff[p_ptCtx->uFrameCtr] )
-                                        {
-                                            /* Stuff with escape */
-                                            p_puStuffedBuf[l_uNFillB] = ECU_ESC;
-                                            p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA;
-                                            l_uNFillB++;
-                                            p_ptCtx->uFrameCtr++;
-                                        }
-                                        else if( ECU_ESC == p_ptCtx->puBuff[p_ptCtx->uFrameCtr] )
-                                        {
-                                            /* Stuff with escape */
-                                            p_puStuffedBuf[l_uNFillB] = ECU_ESC;
+                                            eCU_BSTF_UpdateCrc(p_ptCtx, &p_ptCtx->puSeg[l_uSegOff], 1u);
+                                            p_puStuffedBuf[l_uNFillB] = ( ( NULL == p_ptCtx->ptCfg ) ? ECU_ESC :
+                                                                                                 p_ptCtx->ptCfg->uEsc );
                                             p_ptCtx->eSM = e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA;
                                             l_uNFillB++;
                                             p_ptCtx->uFrameCtr++;
                                         }
                                         else
                                         {
-                                            /* Can insert data and continue parsing other raw data */
-                                            p_puStuffedBuf[l_uNFillB] = p_ptCtx->puBuff[p_ptCtx->uFrameCtr];
-                                            l_uNFillB++;
-                                            p_ptCtx->uFrameCtr++;
+                                            /* Can insert data and continue parsing other raw data. Search how many
+                                             * following byte doesn't need to be stuffed and copy all of them */
+                                            l_uRunL = eCU_BSTF_GetSegL(p_ptCtx, p_ptCtx->uSegIdx) - l_uSegOff;
+                                            if( l_uRunL > ( p_uMaxBufL - l_uNFillB ) )
+                                            {
+                                                l_uRunL = p_uMaxBufL - l_uNFillB;
+                                            }
+
+                                            l_uRunL = eCU_BSTF_GetRawRunL(p_ptCtx->ptCfg, &p_ptCtx->puSeg[l_uSegOff],
+                                                                          l_uRunL);
+                                            (void)memcpy(&p_puStuffedBuf[l_uNFillB], &p_ptCtx->puSeg[l_uSegOff],
+                                                         l_uRunL);
+                                            eCU_BSTF_UpdateCrc(p_ptCtx, &p_ptCtx->puSeg[l_uSegOff], l_uRunL);
+                                            l_uNFillB += l_uRunL;
+                                            p_ptCtx->uFrameCtr += l_uRunL;
                                         }
                                     }
 
@@ -444,8 +703,8 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
                                 case e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA :
                                 {
                                     /* Something from an old iteration  */
-                                    l_uPrecB = p_ptCtx->puBuff[p_ptCtx->uFrameCtr - 1u];
-                                    p_puStuffedBuf[l_uNFillB] = ( (uint8_t) ~( l_uPrecB ) );
+                                    l_uPrecB = p_ptCtx->puSeg[( p_ptCtx->uFrameCtr - p_ptCtx->uSegStart ) - 1u];
+                                    p_puStuffedBuf[l_uNFillB] = eCU_BSTF_XformByte(p_ptCtx->ptCfg, l_uPrecB);
                                     l_uNFillB++;
 
                                     /* After this we can continue parsing raw data */
@@ -457,7 +716,8 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
                                 case e_eCU_BSTFPRV_SM_NEEDEOF :
                                 {
                                     /* End of frame */
-                                    p_puStuffedBuf[l_uNFillB] = ECU_EOF;
+                                    p_puStuffedBuf[l_uNFillB] = ( ( NULL == p_ptCtx->ptCfg ) ? ECU_EOF :
+                                                                                             p_ptCtx->ptCfg->uEof );
                                     p_ptCtx->eSM = e_eCU_BSTFPRV_SM_STUFFEND;
                                     l_uNFillB++;
 
@@ -495,6 +755,195 @@ e_eCU_BSTF_RES eCU_BSTF_GetStufChunk(t_eCU_BSTF_Ctx* const p_ptCtx, uint8_t* p_p
 }
 
 
+e_eCU_BSTF_RES eCU_BSTF_GetStufChunkCirq(t_eCU_BSTF_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* const p_ptCirq,
+                                         uint32_t* const p_puGettedL)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+    uint8_t* l_puSeg;
+    uint32_t l_uSegL;
+    uint32_t l_uSegN;
+    uint32_t l_uNFillB;
+    uint32_t l_uGettedL;
+    e_eCU_CIRQ_RES l_eCirqRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCirq ) || ( NULL == p_puGettedL ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( p_ptCtx->uFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_BSTF_RES_NOINITFRAME;
+                }
+                else if( e_eCU_BSTFPRV_SM_STUFFEND == p_ptCtx->eSM )
+                {
+                    /* Nothing more, even if the queue is full */
+                    *p_puGettedL = 0u;
+                    l_eRes = e_eCU_BSTF_RES_FRAMEENDED;
+                }
+                else
+                {
+                    /* The free space of the queue is at most divided in two contiguous area */
+                    l_uNFillB = 0u;
+                    l_uSegN = 0u;
+                    l_eRes = e_eCU_BSTF_RES_OK;
+
+                    while( ( l_uSegN < 2u ) && ( e_eCU_BSTF_RES_OK == l_eRes ) )
+                    {
+                        l_eCirqRes = eCU_CIRQ_GetFreeSeg(p_ptCirq, &l_puSeg, &l_uSegL);
+
+                        if( e_eCU_CIRQ_RES_OK != l_eCirqRes )
+                        {
+                            l_eRes = eCU_BSTF_ConvertCirqRes(l_eCirqRes);
+                        }
+                        else if( l_uSegL <= 0u )
+                        {
+                            /* Queue full */
+                            l_uSegN = 2u;
+                        }
+                        else
+                        {
+                            /* Stuff directly in the queue memory, and commit only what is written */
+                            l_eRes = eCU_BSTF_GetStufChunk(p_ptCtx, l_puSeg, l_uSegL, &l_uGettedL);
+
+                            if( ( ( e_eCU_BSTF_RES_OK == l_eRes ) || ( e_eCU_BSTF_RES_FRAMEENDED == l_eRes ) ) &&
+                                ( l_uGettedL > 0u ) )
+                            {
+                                l_eCirqRes = eCU_CIRQ_CommitData(p_ptCirq, l_uGettedL);
+
+                                if( e_eCU_CIRQ_RES_OK != l_eCirqRes )
+                                {
+                                    l_eRes = eCU_BSTF_ConvertCirqRes(l_eCirqRes);
+                                }
+                                else
+                                {
+                                    l_uNFillB += l_uGettedL;
+                                }
+                            }
+
+                            l_uSegN++;
+                        }
+                    }
+
+                    *p_puGettedL = l_uNFillB;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTF_RES eCU_BSTF_StuffBuf(const uint8_t* p_puData, const uint32_t p_uDataL, uint8_t* p_puStuffedBuf,
+                                 const uint32_t p_uMaxBufL, uint32_t* const p_puStuffedL)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puData ) || ( NULL == p_puStuffedBuf ) || ( NULL == p_puStuffedL ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check param validity */
+        if( p_uDataL <= 0u )
+        {
+            l_eRes = e_eCU_BSTF_RES_BADPARAM;
+        }
+        else
+        {
+            l_eRes = eCU_BSTF_StuffOne(p_puData, p_uDataL, p_puStuffedBuf, p_uMaxBufL, p_puStuffedL);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTF_RES eCU_BSTF_StuffBatch(const t_eCU_BSTF_Seg* p_ptFrame, const uint32_t p_uFrameN, uint8_t* p_puStuffedBuf,
+                                   const uint32_t p_uMaxBufL, uint32_t* const p_puFrameOff,
+                                   uint32_t* const p_puStuffedN, uint32_t* const p_puStuffedL)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+    uint32_t l_uFrameIdx;
+    uint32_t l_uNFillB;
+    uint32_t l_uFrameStuffL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptFrame ) || ( NULL == p_puStuffedBuf ) || ( NULL == p_puFrameOff ) || ( NULL == p_puStuffedN ) ||
+        ( NULL == p_puStuffedL ) )
+	{
+		l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check param validity */
+        if( ( p_uFrameN <= 0u ) || ( p_uMaxBufL <= 0u ) )
+        {
+            l_eRes = e_eCU_BSTF_RES_BADPARAM;
+        }
+        else
+        {
+            /* Every frame is validated when reached, so frame before an invalid one are stuffed anyway */
+            l_uFrameIdx = 0u;
+            l_uNFillB = 0u;
+            l_eRes = e_eCU_BSTF_RES_OK;
+
+            while( ( l_uFrameIdx < p_uFrameN ) && ( e_eCU_BSTF_RES_OK == l_eRes ) )
+            {
+                if( NULL == p_ptFrame[l_uFrameIdx].puData )
+                {
+                    l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+                }
+                else if( p_ptFrame[l_uFrameIdx].uDataL <= 0u )
+                {
+                    l_eRes = e_eCU_BSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    l_eRes = eCU_BSTF_StuffOne(p_ptFrame[l_uFrameIdx].puData, p_ptFrame[l_uFrameIdx].uDataL,
+                                               &p_puStuffedBuf[l_uNFillB], ( p_uMaxBufL - l_uNFillB ),
+                                               &l_uFrameStuffL);
+
+                    if( e_eCU_BSTF_RES_OK == l_eRes )
+                    {
+                        p_puFrameOff[l_uFrameIdx] = l_uNFillB;
+                        l_uNFillB += l_uFrameStuffL;
+                        l_uFrameIdx++;
+                    }
+                }
+            }
+
+            /* A frame that doesn't fit is not reported, only the complete ones */
+            *p_puStuffedN = l_uFrameIdx;
+            *p_puStuffedL = l_uNFillB;
+        }
+	}
+
+	return l_eRes;
+}
+
+
 
 /***********************************************************************************************************************
  *  PRIVATE FUNCTION
@@ -505,14 +954,17 @@ static bool_t eCU_BSTF_IsStatusStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx)
     uint8_t l_uPrecB;
 
 	/* Check basic context validity */
-	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) )
+	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) || ( NULL == p_ptCtx->puFrame ) ||
+        ( NULL == p_ptCtx->puSeg ) || ( ( NULL != p_ptCtx->ptCfg ) && ( false == p_ptCtx->ptCfg->bIsInit ) ) )
 	{
 		l_eRes = false;
 	}
 	else
 	{
-        /* Check context limit validity */
-        if( ( p_ptCtx->uFrameL > p_ptCtx->uBuffL ) || ( p_ptCtx->uFrameCtr > p_ptCtx->uFrameL ) )
+        /* Check context limit validity, only a frame placed in our buffer is limited by the buffer size */
+        if( ( ( NULL == p_ptCtx->ptSeg ) && ( p_ptCtx->puFrame == p_ptCtx->puBuff ) &&
+              ( p_ptCtx->uFrameL > p_ptCtx->uBuffL ) ) ||
+            ( p_ptCtx->uFrameCtr > eCU_BSTF_GetTotL(p_ptCtx) ) || ( false == eCU_BSTF_IsSegStillCoherent(p_ptCtx) ) )
         {
             l_eRes = false;
         }
@@ -534,7 +986,8 @@ static bool_t eCU_BSTF_IsStatusStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx)
                 else
                 {
                     /* Check data coherence on EOF */
-                    if( ( e_eCU_BSTFPRV_SM_STUFFEND == p_ptCtx->eSM ) && ( p_ptCtx->uFrameCtr != p_ptCtx->uFrameL ) )
+                    if( ( e_eCU_BSTFPRV_SM_STUFFEND == p_ptCtx->eSM ) &&
+                        ( p_ptCtx->uFrameCtr != eCU_BSTF_GetTotL(p_ptCtx) ) )
                     {
                         l_eRes = false;
                     }
@@ -543,14 +996,22 @@ static bool_t eCU_BSTF_IsStatusStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx)
                         /* Check data coherence on precedent data */
                         if( e_eCU_BSTFPRV_SM_NEEDNEGATEPRECDATA == p_ptCtx->eSM )
                         {
-                            l_uPrecB = p_ptCtx->puBuff[p_ptCtx->uFrameCtr - 1u];
-                            if( ( ECU_ESC != l_uPrecB ) && ( ECU_EOF != l_uPrecB ) && ( ECU_SOF != l_uPrecB ) )
+                            /* The escaped byte is always in the current segment */
+                            if( p_ptCtx->uFrameCtr <= p_ptCtx->uSegStart )
                             {
                                 l_eRes = false;
                             }
                             else
                             {
-                                l_eRes = true;
+                                l_uPrecB = p_ptCtx->puSeg[( p_ptCtx->uFrameCtr - p_ptCtx->uSegStart ) - 1u];
+                                if( false == eCU_BSTF_IsStuffByte(p_ptCtx->ptCfg, l_uPrecB) )
+                                {
+                                    l_eRes = false;
+                                }
+                                else
+                                {
+                                    l_eRes = true;
+                                }
                             }
                         }
                         else
@@ -563,5 +1024,292 @@ static bool_t eCU_BSTF_IsStatusStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx)
         }
 	}
 
+    return l_eRes;
+}
+
+static uint32_t eCU_BSTF_GetRawRunL(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData, const uint32_t p_uMaxL)
+{
+    uint32_t l_uRunL;
+
+    l_uRunL = 0u;
+
+    if( NULL == p_ptCfg )
+    {
+        /* Check four byte for every iteration, most of the payload byte doesn't need to be stuffed */
+        l_uRunL = eCU_STFPRV_GetNonDelimRunL(p_puData, p_uMaxL, ECU_SOF, ECU_EOF, ECU_ESC);
+    }
+    else
+    {
+        /* The number of stuffed byte can be any, so every byte is classified with the lookup table */
+        while( ( l_uRunL < p_uMaxL ) &&
+               ( 0u == ( ECU_BSTFCFG_CLASS_STUFF & p_ptCfg->auClass[p_puData[l_uRunL]] ) ) )
+        {
+            l_uRunL++;
+        }
+    }
+
+    return l_uRunL;
+}
+
+static bool_t eCU_BSTF_IsStuffByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCfg )
+    {
+        l_bRes = ( ( ECU_SOF == p_uByte ) || ( ECU_EOF == p_uByte ) || ( ECU_ESC == p_uByte ) );
+    }
+    else
+    {
+        l_bRes = ( 0u != ( ECU_BSTFCFG_CLASS_STUFF & p_ptCfg->auClass[p_uByte] ) );
+    }
+
+    return l_bRes;
+}
+
+static uint8_t eCU_BSTF_XformByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte)
+{
+    uint8_t l_uRes;
+
+    if( NULL == p_ptCfg )
+    {
+        l_uRes = ( uint8_t ) ~p_uByte;
+    }
+    else
+    {
+        l_uRes = p_ptCfg->auXform[p_uByte];
+    }
+
+    return l_uRes;
+}
+
+static bool_t eCU_BSTF_IsSegStillCoherent(const t_eCU_BSTF_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+    if( ( true == p_ptCtx->bCrcEn ) && ( p_ptCtx->uSegIdx == p_ptCtx->uSegN ) )
+    {
+        /* Stuffing the CRC trailer */
+        if( ( p_ptCtx->puSeg != p_ptCtx->auCrc ) || ( p_ptCtx->uSegStart != p_ptCtx->uFrameL ) ||
+            ( p_ptCtx->uSegStart > p_ptCtx->uFrameCtr ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+    }
+    else if( NULL == p_ptCtx->ptSeg )
+    {
+        /* Single memory area, the segment is the whole frame */
+        if( ( 1u != p_ptCtx->uSegN ) || ( 0u != p_ptCtx->uSegIdx ) || ( 0u != p_ptCtx->uSegStart ) ||
+            ( p_ptCtx->puSeg != p_ptCtx->puFrame ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+    }
+    else
+    {
+        /* Current segment must be one of the array, and the frame counter must point inside of it */
+        if( p_ptCtx->uSegIdx >= p_ptCtx->uSegN )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            if( ( p_ptCtx->puSeg != p_ptCtx->ptSeg[p_ptCtx->uSegIdx].puData ) ||
+                ( p_ptCtx->uSegStart > p_ptCtx->uFrameCtr ) ||
+                ( ( p_ptCtx->uFrameCtr - p_ptCtx->uSegStart ) > p_ptCtx->ptSeg[p_ptCtx->uSegIdx].uDataL ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                l_eRes = true;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eCU_BSTF_GetSegL(const t_eCU_BSTF_Ctx* p_ptCtx, const uint32_t p_uSegIdx)
+{
+    uint32_t l_uSegL;
+
+    if( p_uSegIdx >= p_ptCtx->uSegN )
+    {
+        /* CRC trailer */
+        l_uSegL = ECU_BSTF_CRCL;
+    }
+    else if( NULL == p_ptCtx->ptSeg )
+    {
+        /* Single memory area */
+        l_uSegL = p_ptCtx->uFrameL;
+    }
+    else
+    {
+        l_uSegL = p_ptCtx->ptSeg[p_uSegIdx].uDataL;
+    }
+
+    return l_uSegL;
+}
+
+static void eCU_BSTF_SetSingleSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puFrame)
+{
+    p_ptCtx->puFrame = p_puFrame;
+    p_ptCtx->puSeg = p_puFrame;
+    p_ptCtx->ptSeg = NULL;
+    p_ptCtx->uSegN = 1u;
+    p_ptCtx->uSegIdx = 0u;
+    p_ptCtx->uSegStart = 0u;
+}
+
+static uint32_t eCU_BSTF_GetTotL(const t_eCU_BSTF_Ctx* p_ptCtx)
+{
+    uint32_t l_uTotL;
+
+    if( true == p_ptCtx->bCrcEn )
+    {
+        /* Payload + CRC trailer */
+        l_uTotL = p_ptCtx->uFrameL + ECU_BSTF_CRCL;
+    }
+    else
+    {
+        l_uTotL = p_ptCtx->uFrameL;
+    }
+
+    return l_uTotL;
+}
+
+static const uint8_t* eCU_BSTF_NextSeg(t_eCU_BSTF_Ctx* const p_ptCtx, const uint32_t p_uSegIdx, const uint32_t p_uCrc,
+                                       uint8_t* p_puCrcBuf)
+{
+    const uint8_t* l_puSeg;
+
+    if( p_uSegIdx >= p_ptCtx->uSegN )
+    {
+        /* Payload ended, the CRC is now complete and can be stuffed in big endian */
+        p_puCrcBuf[0u] = (uint8_t)( ( p_uCrc >> 24u ) & 0xFFu );
+        p_puCrcBuf[1u] = (uint8_t)( ( p_uCrc >> 16u ) & 0xFFu );
+        p_puCrcBuf[2u] = (uint8_t)( ( p_uCrc >> 8u  ) & 0xFFu );
+        p_puCrcBuf[3u] = (uint8_t)( ( p_uCrc        ) & 0xFFu );
+        l_puSeg = p_puCrcBuf;
+    }
+    else
+    {
+        l_puSeg = p_ptCtx->ptSeg[p_uSegIdx].puData;
+    }
+
+    return l_puSeg;
+}
+
+static void eCU_BSTF_UpdateCrc(t_eCU_BSTF_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    /* Only payload byte are part of the CRC */
+    if( ( true == p_ptCtx->bCrcEn ) && ( p_ptCtx->uSegIdx < p_ptCtx->uSegN ) )
+    {
+        (void)eCU_CRC_32Seed(p_ptCtx->uCrc, p_puData, p_uDataL, &p_ptCtx->uCrc);
+    }
+}
+
+static e_eCU_BSTF_RES eCU_BSTF_StuffOne(const uint8_t* p_puData, const uint32_t p_uDataL, uint8_t* p_puStuffedBuf,
+                                        const uint32_t p_uMaxBufL, uint32_t* const p_puStuffedL)
+{
+	/* Local variable */
+	e_eCU_BSTF_RES l_eRes;
+    uint32_t l_uDataIdx;
+    uint32_t l_uNFillB;
+    uint32_t l_uRunL;
+
+    /* Need space at least for SOF, one byte and EOF */
+    if( p_uMaxBufL < 3u )
+    {
+        l_eRes = e_eCU_BSTF_RES_OUTOFMEM;
+    }
+    else
+    {
+        /* Start of frame, and keep space for the end of frame */
+        p_puStuffedBuf[0u] = ECU_SOF;
+        l_uNFillB = 1u;
+        l_uDataIdx = 0u;
+        l_eRes = e_eCU_BSTF_RES_OK;
+
+        while( ( l_uDataIdx < p_uDataL ) && ( e_eCU_BSTF_RES_OK == l_eRes ) )
+        {
+            /* Copy all the raw data that doesn't need to be stuffed */
+            l_uRunL = eCU_BSTF_GetRawRunL(NULL, &p_puData[l_uDataIdx], ( p_uDataL - l_uDataIdx ) );
+
+            if( l_uRunL > ( ( p_uMaxBufL - 1u ) - l_uNFillB ) )
+            {
+                l_eRes = e_eCU_BSTF_RES_OUTOFMEM;
+            }
+            else
+            {
+                (void)memcpy(&p_puStuffedBuf[l_uNFillB], &p_puData[l_uDataIdx], l_uRunL);
+                l_uNFillB += l_uRunL;
+                l_uDataIdx += l_uRunL;
+
+                /* Stuff the special byte found */
+                if( l_uDataIdx < p_uDataL )
+                {
+                    if( ( ( p_uMaxBufL - 1u ) - l_uNFillB ) < 2u )
+                    {
+                        l_eRes = e_eCU_BSTF_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        p_puStuffedBuf[l_uNFillB] = ECU_ESC;
+                        p_puStuffedBuf[l_uNFillB + 1u] = ( uint8_t ) ~p_puData[l_uDataIdx];
+                        l_uNFillB += 2u;
+                        l_uDataIdx++;
+                    }
+                }
+            }
+        }
+
+        if( e_eCU_BSTF_RES_OK == l_eRes )
+        {
+            /* End of frame, space already reserved */
+            p_puStuffedBuf[l_uNFillB] = ECU_EOF;
+            l_uNFillB++;
+            *p_puStuffedL = l_uNFillB;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BSTF_RES eCU_BSTF_ConvertCirqRes(const e_eCU_CIRQ_RES p_eCirqRes)
+{
+    e_eCU_BSTF_RES l_eRes;
+
+    switch( p_eCirqRes )
+    {
+        case e_eCU_CIRQ_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            break;
+        }
+
+        default:
+        {
+            /* Bad pointer, bad parameter or full queue, the queue can't be used as expected */
+            l_eRes = e_eCU_BSTF_RES_BADPARAM;
+            break;
+        }
+    }
+
     return l_eRes;
 }
\ No newline at end of file
@@ -0,0 +1,239 @@
+/**
+ * @file       eCU_BSTFCFG.c
+ *
+ * @brief      Byte stuffer delimiter configuration
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_BSTFCFG.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_BSTFCFG_ClearTable(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uSof, const uint8_t p_uEof,
+                                   const uint8_t p_uEsc, const uint8_t p_uXorMask);
+static bool_t eCU_BSTFCFG_AddXorByte(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uByte);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitCtx(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uSof, const uint8_t p_uEof,
+                                      const uint8_t p_uEsc, const uint8_t p_uXorMask)
+{
+	/* Local variable */
+	e_eCU_BSTFCFG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BSTFCFG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uEsc == p_uSof ) || ( p_uEsc == p_uEof ) || ( 0u == p_uXorMask ) )
+        {
+            l_eRes = e_eCU_BSTFCFG_RES_BADPARAM;
+        }
+        else
+        {
+            /* Delimiter are classified before adding them as stuffed byte, so a transformed delimiter that is a
+             * delimiter itself is found */
+            eCU_BSTFCFG_ClearTable(p_ptCtx, p_uSof, p_uEof, p_uEsc, p_uXorMask);
+
+            if( ( false == eCU_BSTFCFG_AddXorByte(p_ptCtx, p_uSof) ) ||
+                ( false == eCU_BSTFCFG_AddXorByte(p_ptCtx, p_uEof) ) ||
+                ( false == eCU_BSTFCFG_AddXorByte(p_ptCtx, p_uEsc) ) )
+            {
+                p_ptCtx->bIsInit = false;
+                l_eRes = e_eCU_BSTFCFG_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->bIsInit = true;
+                l_eRes = e_eCU_BSTFCFG_RES_OK;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitHdlc(t_eCU_BSTFCFG_Ctx* const p_ptCtx)
+{
+    /* Local variable */
+    e_eCU_BSTFCFG_RES l_eRes;
+    uint32_t l_uIdx;
+
+    l_eRes = eCU_BSTFCFG_InitCtx(p_ptCtx, ECU_BSTFCFG_HDLC_FLAG, ECU_BSTFCFG_HDLC_FLAG, ECU_BSTFCFG_HDLC_ESC,
+                                 ECU_BSTFCFG_HDLC_XOR);
+
+    if( e_eCU_BSTFCFG_RES_OK == l_eRes )
+    {
+        /* RFC 1662: the receiver must xor every byte found after the escape, not only the one stuffed by us */
+        for( l_uIdx = 0u; l_uIdx < ECU_BSTFCFG_TABLEL; l_uIdx++ )
+        {
+            if( 0u == ( ( ECU_BSTFCFG_CLASS_SOF | ECU_BSTFCFG_CLASS_EOF | ECU_BSTFCFG_CLASS_ESC ) &
+                        p_ptCtx->auClass[l_uIdx] ) )
+            {
+                p_ptCtx->auClass[l_uIdx] |= ECU_BSTFCFG_CLASS_RXVAL;
+                p_ptCtx->auXform[l_uIdx] = (uint8_t)( l_uIdx ^ ECU_BSTFCFG_HDLC_XOR );
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_InitSlip(t_eCU_BSTFCFG_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eCU_BSTFCFG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BSTFCFG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* A xor mask of zero mark a configuration that is not defined by a xor transformation */
+        eCU_BSTFCFG_ClearTable(p_ptCtx, ECU_BSTFCFG_SLIP_END, ECU_BSTFCFG_SLIP_END, ECU_BSTFCFG_SLIP_ESC, 0u);
+
+        p_ptCtx->auClass[ECU_BSTFCFG_SLIP_END] |= ECU_BSTFCFG_CLASS_STUFF;
+        p_ptCtx->auClass[ECU_BSTFCFG_SLIP_ESC] |= ECU_BSTFCFG_CLASS_STUFF;
+        p_ptCtx->auClass[ECU_BSTFCFG_SLIP_ESCEND] |= ECU_BSTFCFG_CLASS_ESCVAL;
+        p_ptCtx->auClass[ECU_BSTFCFG_SLIP_ESCESC] |= ECU_BSTFCFG_CLASS_ESCVAL;
+
+        p_ptCtx->auXform[ECU_BSTFCFG_SLIP_END] = ECU_BSTFCFG_SLIP_ESCEND;
+        p_ptCtx->auXform[ECU_BSTFCFG_SLIP_ESC] = ECU_BSTFCFG_SLIP_ESCESC;
+        p_ptCtx->auXform[ECU_BSTFCFG_SLIP_ESCEND] = ECU_BSTFCFG_SLIP_END;
+        p_ptCtx->auXform[ECU_BSTFCFG_SLIP_ESCESC] = ECU_BSTFCFG_SLIP_ESC;
+
+        p_ptCtx->bIsInit = true;
+        l_eRes = e_eCU_BSTFCFG_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_IsInit(t_eCU_BSTFCFG_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_BSTFCFG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_BSTFCFG_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_BSTFCFG_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BSTFCFG_RES eCU_BSTFCFG_AddStuffByte(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uByte)
+{
+	/* Local variable */
+	e_eCU_BSTFCFG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BSTFCFG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BSTFCFG_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check param validity */
+            if( 0u == p_ptCtx->uXorMask )
+            {
+                l_eRes = e_eCU_BSTFCFG_RES_BADPARAM;
+            }
+            else
+            {
+                if( false == eCU_BSTFCFG_AddXorByte(p_ptCtx, p_uByte) )
+                {
+                    l_eRes = e_eCU_BSTFCFG_RES_BADPARAM;
+                }
+                else
+                {
+                    l_eRes = e_eCU_BSTFCFG_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_BSTFCFG_ClearTable(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uSof, const uint8_t p_uEof,
+                                   const uint8_t p_uEsc, const uint8_t p_uXorMask)
+{
+    (void)memset(p_ptCtx->auClass, 0, sizeof(p_ptCtx->auClass));
+    (void)memset(p_ptCtx->auXform, 0, sizeof(p_ptCtx->auXform));
+
+    p_ptCtx->uSof = p_uSof;
+    p_ptCtx->uEof = p_uEof;
+    p_ptCtx->uEsc = p_uEsc;
+    p_ptCtx->uXorMask = p_uXorMask;
+
+    p_ptCtx->auClass[p_uSof] |= ECU_BSTFCFG_CLASS_SOF;
+    p_ptCtx->auClass[p_uEof] |= ECU_BSTFCFG_CLASS_EOF;
+    p_ptCtx->auClass[p_uEsc] |= ECU_BSTFCFG_CLASS_ESC;
+}
+
+static bool_t eCU_BSTFCFG_AddXorByte(t_eCU_BSTFCFG_Ctx* const p_ptCtx, const uint8_t p_uByte)
+{
+    bool_t l_bRes;
+    uint8_t l_uXform;
+
+    l_uXform = (uint8_t)( p_uByte ^ p_ptCtx->uXorMask );
+
+    if( 0u != ( ECU_BSTFCFG_CLASS_STUFF & p_ptCtx->auClass[p_uByte] ) )
+    {
+        /* Already stuffed, SOF and EOF can be the same byte */
+        l_bRes = true;
+    }
+    else if( ( 0u != ( ECU_BSTFCFG_CLASS_ESCVAL & p_ptCtx->auClass[p_uByte] ) ) ||
+             ( 0u != ( ( uint8_t ) ~ECU_BSTFCFG_CLASS_RXVAL & p_ptCtx->auClass[l_uXform] ) ) )
+    {
+        /* The byte is the transformation of another stuffed byte, or is transformed in a byte already used. A byte
+         * only accepted after ESC is free, and his transformation is already the right one */
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->auClass[p_uByte] |= ECU_BSTFCFG_CLASS_STUFF;
+        p_ptCtx->auClass[l_uXform] |= ECU_BSTFCFG_CLASS_ESCVAL;
+        p_ptCtx->auXform[p_uByte] = l_uXform;
+        p_ptCtx->auXform[l_uXform] = p_uByte;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
\ No newline at end of file
@@ -11,6 +11,8 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eCU_BUNSTF.h"
+#include "eCU_CRC.h"
+#include "eCU_STFPRV.h"
 
 
 
@@ -18,6 +20,15 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eCU_BUNSTF_IsStatusStillCoherent(const t_eCU_BUNSTF_Ctx* p_ptCtx);
+static e_eCU_BUNSTF_RES eCU_BUNSTF_UnstufCore(t_eCU_BUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL);
+static uint32_t eCU_BUNSTF_SkipToSof(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData, const uint32_t p_uMaxL);
+static uint32_t eCU_BUNSTF_GetRawRunL(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData,
+                                      const uint32_t p_uMaxL);
+static uint8_t eCU_BUNSTF_GetClass(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte);
+static uint8_t eCU_BUNSTF_XformByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte);
+static void eCU_BUNSTF_Rearm(t_eCU_BUNSTF_Ctx* const p_ptCtx);
+static e_eCU_BUNSTF_RES eCU_BUNSTF_ConvertCirqRes(const e_eCU_CIRQ_RES p_eCirqRes);
 
 
 
@@ -48,6 +59,12 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_InitCtx(t_eCU_BUNSTF_Ctx* const p_ptCtx, uint8_t* p_
             p_ptCtx->puBuff = p_puBuff;
             p_ptCtx->uBuffL = p_uBuffL;
             p_ptCtx->uFrameCtr = 0u;
+            p_ptCtx->bCrcEn = false;
+            p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+            p_ptCtx->ptCfg = NULL;
+            p_ptCtx->bHuntEn = false;
+            p_ptCtx->uSkipL = 0u;
+            p_ptCtx->bEndIsSof = false;
             p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
             l_eRes = e_eCU_BUNSTF_RES_OK;
         }
@@ -103,6 +120,45 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_NewFrame(t_eCU_BUNSTF_Ctx* const p_ptCtx)
             {
                 /* Update index */
                 p_ptCtx->uFrameCtr = 0u;
+                eCU_BUNSTF_Rearm(p_ptCtx);
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetCrcMode(t_eCU_BUNSTF_Ctx* const p_ptCtx, const bool_t p_bCrcEn)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Discharge the current frame */
+                p_ptCtx->bCrcEn = p_bCrcEn;
+                p_ptCtx->uFrameCtr = 0u;
+                p_ptCtx->bEndIsSof = false;
 				p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
                 l_eRes = e_eCU_BUNSTF_RES_OK;
             }
@@ -112,6 +168,123 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_NewFrame(t_eCU_BUNSTF_Ctx* const p_ptCtx)
 	return l_eRes;
 }
 
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetCfg(t_eCU_BUNSTF_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCfg ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity */
+                if( false == p_ptCfg->bIsInit )
+                {
+                    l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Discharge the current frame */
+                    p_ptCtx->ptCfg = p_ptCfg;
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->bEndIsSof = false;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
+                    l_eRes = e_eCU_BUNSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_SetHuntMode(t_eCU_BUNSTF_Ctx* const p_ptCtx, const bool_t p_bHuntEn)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                p_ptCtx->bHuntEn = p_bHuntEn;
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_GetSkippedL(t_eCU_BUNSTF_Ctx* const p_ptCtx, uint32_t* const p_puSkipL)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSkipL ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                *p_puSkipL = p_ptCtx->uSkipL;
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eCU_BUNSTF_RES eCU_BUNSTF_GetUnstufData(t_eCU_BUNSTF_Ctx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puL)
 {
 	/* Local variable */
@@ -315,25 +488,24 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunk(t_eCU_BUNSTF_Ctx* const p_ptCtx, const
 {
 	/* Local variable */
 	e_eCU_BUNSTF_RES l_eRes;
-    uint32_t l_uNExamByte;
-    uint8_t l_uCurByte;
+    uint32_t l_uSkipL;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puStuffBuf ) || ( NULL == p_puConsumedBufL ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puStuffBuf ) || ( NULL == p_puConsumedBufL ) ) )
 	{
 		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
             }
@@ -346,168 +518,27 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunk(t_eCU_BUNSTF_Ctx* const p_ptCtx, const
                 }
                 else
                 {
-                    /* Init counter */
-                    l_uNExamByte = 0u;
-
-                    /* Init l_eRes */
-                    l_eRes = e_eCU_BUNSTF_RES_OK;
+                    l_uSkipL = 0u;
 
-                    /* Elab all data */
-                    while( ( l_uNExamByte < p_uStuffBufL ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) &&
-					       ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND != p_ptCtx->eSM ) &&
-                           ( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL != p_ptCtx->eSM ) )
+                    if( ( true == p_ptCtx->bHuntEn ) && ( e_eCU_BUNSTFPRV_SM_NEEDSOF == p_ptCtx->eSM ) )
                     {
-                        /* Read current byte */
-                        l_uCurByte = p_puStuffBuf[l_uNExamByte];
-
-                        /* Decide what to do */
-						switch( p_ptCtx->eSM )
-						{
-							case e_eCU_BUNSTFPRV_SM_NEEDSOF:
-							{
-								/* Wait SOF, discharge others */
-								if( ECU_SOF == l_uCurByte )
-								{
-									/* Found start */
-									p_ptCtx->uFrameCtr = 0u;
-									p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
-								}
-								else
-								{
-									/* Waiting for start, no other bytes */
-                                    p_ptCtx->uFrameCtr = 0u;
-                                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
-								}
-								l_uNExamByte++;
-								break;
-							}
-
-							case e_eCU_BUNSTFPRV_SM_NEEDRAWDATA:
-							{
-								if( ECU_SOF == l_uCurByte )
-								{
-									/* Found start, but wasn't expected */
-									p_ptCtx->uFrameCtr = 0u;
-                                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
-                                    l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
-									l_uNExamByte++;
-								}
-								else if( ECU_EOF == l_uCurByte )
-								{
-									if( p_ptCtx->uFrameCtr <= 0u )
-									{
-										/* Found end, but no data received..  */
-                                        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
-									}
-									else
-									{
-										/* Can close the frame, yey */
-										p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFEND;
-									}
-
-									l_uNExamByte++;
-								}
-								else if( ECU_ESC == l_uCurByte )
-								{
-									/* Next data will be negated data */
-									p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDNEGATEDATA;
-									l_uNExamByte++;
-								}
-								else
-								{
-									/* Received good raw data */
-									if( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL )
-									{
-										/* No more data avaiable to save that thing */
-										l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
-									}
-									else
-									{
-										/* Only raw data */
-										p_ptCtx->puBuff[p_ptCtx->uFrameCtr] = l_uCurByte;
-										p_ptCtx->uFrameCtr++;
-										l_uNExamByte++;
-									}
-								}
-								break;
-							}
-
-							case e_eCU_BUNSTFPRV_SM_NEEDNEGATEDATA:
-							{
-								if( ECU_SOF == l_uCurByte )
-								{
-									/* Found start, but wasn't expected */
-									p_ptCtx->uFrameCtr = 0u;
-                                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
-                                    l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
-									l_uNExamByte++;
-								}
-								else if( ( ECU_EOF == l_uCurByte ) ||
-								         ( ECU_ESC == l_uCurByte ) )
-								{
-									/* Found and error, we were expecting raw negated data here.  */
-                                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
-									l_uNExamByte++;
-								}
-								else
-								{
-									/* Received negated data */
-									if( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL )
-									{
-										/* No more data avaiable to save that thing */
-										l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
-									}
-									else
-									{
-										/* Is it true that negate data is present ? */
-										if( ( ECU_SOF == ( ( uint8_t ) ~l_uCurByte ) ) ||
-											( ECU_EOF == ( ( uint8_t ) ~l_uCurByte ) ) ||
-											( ECU_ESC == ( ( uint8_t ) ~l_uCurByte ) ) )
-										{
-											/* current data is neg */
-											p_ptCtx->puBuff[p_ptCtx->uFrameCtr] = ( uint8_t ) ( ~l_uCurByte );
-											p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
-											p_ptCtx->uFrameCtr++;
-											l_uNExamByte++;
-										}
-										else
-										{
-											/* Impossible receive a data after esc that is not SOF EOF or ESC neg */
-                                            p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
-											l_uNExamByte++;
-										}
-									}
-								}
-								break;
-							}
-
-							default:
-							{
-								/* Impossible end here, and if so something horrible happened ( memory corruption ) */
-								l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
-								break;
-							}
-						}
+                        /* Hunt mode, data before the SOF is discharged without returning a bad frame */
+                        l_uSkipL = eCU_BUNSTF_SkipToSof(p_ptCtx->ptCfg, p_puStuffBuf, p_uStuffBufL);
+                        p_ptCtx->uSkipL += l_uSkipL;
                     }
 
-					/* Save the l_eRes */
-					*p_puConsumedBufL = l_uNExamByte;
-
-					if( e_eCU_BUNSTF_RES_OK == l_eRes )
-					{
-						if( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM )
-						{
-							l_eRes = e_eCU_BUNSTF_RES_FRAMEENDED;
-						}
-                        else if( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM )
-                        {
-                           l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
-                        }
-                        else
-                        {
-                            /* No error but have other data to unstuff */
-                        }
-					}
+                    if( l_uSkipL >= p_uStuffBufL )
+                    {
+                        /* Still waiting the SOF */
+                        *p_puConsumedBufL = p_uStuffBufL;
+                        l_eRes = e_eCU_BUNSTF_RES_OK;
+                    }
+                    else
+                    {
+                        l_eRes = eCU_BUNSTF_UnstufCore(p_ptCtx, &p_puStuffBuf[l_uSkipL], ( p_uStuffBufL - l_uSkipL ),
+                                                       p_puConsumedBufL);
+                        *p_puConsumedBufL += l_uSkipL;
+                    }
                 }
             }
         }
@@ -517,48 +548,925 @@ e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunk(t_eCU_BUNSTF_Ctx* const p_ptCtx, const
 }
 
 
-
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eCU_BUNSTF_IsStatusStillCoherent(const t_eCU_BUNSTF_Ctx* p_ptCtx)
+e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunkCirq(t_eCU_BUNSTF_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* const p_ptCirq,
+                                             uint32_t* const p_puConsumedBufL)
 {
-    bool_t l_eRes;
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+    const uint8_t* l_puSeg;
+    uint32_t l_uSegL;
+    uint32_t l_uSegN;
+    uint32_t l_uNExamByte;
+    uint32_t l_uConsumed;
+    e_eCU_CIRQ_RES l_eCirqRes;
 
-	/* Check basic context validity */
-	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) )
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCirq ) || ( NULL == p_puConsumedBufL ) )
 	{
-		l_eRes = false;
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
 	}
 	else
 	{
-        /* Check size validity */
-        if( p_ptCtx->uFrameCtr > p_ptCtx->uBuffL )
-        {
-            l_eRes = false;
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* The occupied space of the queue is at most divided in two contiguous area */
+                l_uNExamByte = 0u;
+                l_uSegN = 0u;
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+
+                while( ( l_uSegN < 2u ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) )
+                {
+                    l_eCirqRes = eCU_CIRQ_GetOccupiedSeg(p_ptCirq, &l_puSeg, &l_uSegL);
+
+                    if( e_eCU_CIRQ_RES_OK != l_eCirqRes )
+                    {
+                        l_eRes = eCU_BUNSTF_ConvertCirqRes(l_eCirqRes);
+                    }
+                    else if( l_uSegL <= 0u )
+                    {
+                        /* Queue empty */
+                        l_uSegN = 2u;
+                    }
+                    else
+                    {
+                        /* Unstuff directly from the queue memory, and remove only what is analized */
+                        l_uConsumed = 0u;
+                        l_eRes = eCU_BUNSTF_InsStufChunk(p_ptCtx, l_puSeg, l_uSegL, &l_uConsumed);
+
+                        if( l_uConsumed > 0u )
+                        {
+                            l_eCirqRes = eCU_CIRQ_DiscardData(p_ptCirq, l_uConsumed);
+
+                            if( e_eCU_CIRQ_RES_OK != l_eCirqRes )
+                            {
+                                l_eRes = eCU_BUNSTF_ConvertCirqRes(l_eCirqRes);
+                            }
+                            else
+                            {
+                                l_uNExamByte += l_uConsumed;
+                            }
+                        }
+
+                        l_uSegN++;
+                    }
+                }
+
+                *p_puConsumedBufL = l_uNExamByte;
+            }
         }
-        else
-        {
-            /* Check status coherence */
-            if( ( e_eCU_BUNSTFPRV_SM_NEEDSOF == p_ptCtx->eSM ) && ( 0u != p_ptCtx->uFrameCtr ) )
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_InsStufChunkMulti(t_eCU_BUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, f_eCU_BUNSTF_FrameCb p_fFrameCb,
+                                              t_eCU_BUNSTF_FrameCtx* const p_ptFrameCbCtx,
+                                              uint32_t* const p_puConsumedBufL)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+    e_eCU_BUNSTF_RES l_eFrameRes;
+    uint32_t l_uNExamByte;
+    uint32_t l_uConsumed;
+    uint32_t l_uSkipL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puStuffBuf ) || ( NULL == p_fFrameCb ) || ( NULL == p_ptFrameCbCtx ) ||
+        ( NULL == p_puConsumedBufL ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTF_IsStatusStillCoherent(p_ptCtx) )
             {
-                l_eRes = false;
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
             }
             else
             {
-                /* Check status coherence */
-                if( ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM ) && ( p_ptCtx->uFrameCtr <= 0u ) )
+                /* Check param */
+                if( p_uStuffBufL <= 0u )
                 {
-                    l_eRes = false;
+                    l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
                 }
                 else
                 {
-                    l_eRes = true;
-                }
-            }
+                    /* Frame already returned by eCU_BUNSTF_InsStufChunk */
+                    if( ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM ) ||
+                        ( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM ) )
+                    {
+                        p_ptCtx->uFrameCtr = 0u;
+                        eCU_BUNSTF_Rearm(p_ptCtx);
+                    }
 
-        }
-	}
+                    l_uNExamByte = 0u;
+                    l_eRes = e_eCU_BUNSTF_RES_OK;
+
+                    while( ( l_uNExamByte < p_uStuffBufL ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) )
+                    {
+                        /* Discharge everything until a start of frame */
+                        if( e_eCU_BUNSTFPRV_SM_NEEDSOF == p_ptCtx->eSM )
+                        {
+                            l_uSkipL = eCU_BUNSTF_SkipToSof(p_ptCtx->ptCfg, &p_puStuffBuf[l_uNExamByte],
+                                                            ( p_uStuffBufL - l_uNExamByte ) );
+                            p_ptCtx->uSkipL += l_uSkipL;
+                            l_uNExamByte += l_uSkipL;
+                        }
+
+                        if( l_uNExamByte < p_uStuffBufL )
+                        {
+                            l_eFrameRes = eCU_BUNSTF_UnstufCore(p_ptCtx, &p_puStuffBuf[l_uNExamByte],
+                                                                ( p_uStuffBufL - l_uNExamByte ), &l_uConsumed);
+                            l_uNExamByte += l_uConsumed;
+
+                            switch( l_eFrameRes )
+                            {
+                                case e_eCU_BUNSTF_RES_OK:
+                                case e_eCU_BUNSTF_RES_FRAMERESTART:
+                                {
+                                    /* Frame still ongoing, or already restarted by the core */
+                                    break;
+                                }
+
+                                case e_eCU_BUNSTF_RES_FRAMEENDED:
+                                case e_eCU_BUNSTF_RES_BADFRAME:
+                                case e_eCU_BUNSTF_RES_OUTOFMEM:
+                                {
+                                    /* Report the frame and wait the next one */
+                                    if( true != p_fFrameCb(p_ptFrameCbCtx, l_eFrameRes, p_ptCtx->puBuff,
+                                                           p_ptCtx->uFrameCtr) )
+                                    {
+                                        l_eRes = e_eCU_BUNSTF_RES_CLBCKREPORTERROR;
+                                    }
+
+                                    /* An out of memory frame never consume his closing delimiter */
+                                    p_ptCtx->uFrameCtr = 0u;
+                                    if( e_eCU_BUNSTF_RES_OUTOFMEM == l_eFrameRes )
+                                    {
+                                        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
+                                    }
+                                    else
+                                    {
+                                        eCU_BUNSTF_Rearm(p_ptCtx);
+                                    }
+                                    break;
+                                }
+
+                                default:
+                                {
+                                    /* Impossible end here */
+                                    l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    *p_puConsumedBufL = l_uNExamByte;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_UnstuffBuf(const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL, uint8_t* p_puData,
+                                       const uint32_t p_uMaxDataL, uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+    uint32_t l_uNExamByte;
+    uint32_t l_uNFillB;
+    uint32_t l_uRunL;
+    uint8_t l_uNegByte;
+    bool_t l_bEnded;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puStuffBuf ) || ( NULL == p_puData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check param */
+        if( ( p_uStuffBufL <= 0u ) || ( p_uMaxDataL <= 0u ) )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+        }
+        else
+        {
+            /* The frame must start with a SOF */
+            if( ECU_SOF != p_puStuffBuf[0u] )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+            }
+            else
+            {
+                l_uNExamByte = 1u;
+                l_uNFillB = 0u;
+                l_bEnded = false;
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+
+                while( ( l_uNExamByte < p_uStuffBufL ) && ( false == l_bEnded ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) )
+                {
+                    /* Copy all the raw data */
+                    l_uRunL = eCU_BUNSTF_GetRawRunL(NULL, &p_puStuffBuf[l_uNExamByte],
+                                                    ( p_uStuffBufL - l_uNExamByte ) );
+
+                    if( l_uRunL > ( p_uMaxDataL - l_uNFillB ) )
+                    {
+                        l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        (void)memcpy(&p_puData[l_uNFillB], &p_puStuffBuf[l_uNExamByte], l_uRunL);
+                        l_uNFillB += l_uRunL;
+                        l_uNExamByte += l_uRunL;
+
+                        /* Elaborate the special byte found */
+                        if( l_uNExamByte < p_uStuffBufL )
+                        {
+                            if( ECU_EOF == p_puStuffBuf[l_uNExamByte] )
+                            {
+                                l_bEnded = true;
+                            }
+                            else if( ( ECU_ESC == p_puStuffBuf[l_uNExamByte] ) &&
+                                     ( ( l_uNExamByte + 1u ) < p_uStuffBufL ) )
+                            {
+                                l_uNegByte = ( uint8_t ) ~p_puStuffBuf[l_uNExamByte + 1u];
+
+                                if( ( ECU_SOF != l_uNegByte ) && ( ECU_EOF != l_uNegByte ) &&
+                                    ( ECU_ESC != l_uNegByte ) )
+                                {
+                                    /* Impossible receive a data after esc that is not SOF EOF or ESC neg */
+                                    l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                                }
+                                else if( l_uNFillB >= p_uMaxDataL )
+                                {
+                                    l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
+                                }
+                                else
+                                {
+                                    p_puData[l_uNFillB] = l_uNegByte;
+                                    l_uNFillB++;
+                                }
+                            }
+                            else
+                            {
+                                /* Unexpected SOF or ESC at the end of the frame */
+                                l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                            }
+
+                            l_uNExamByte += ( ( true == l_bEnded ) ? 1u : 2u );
+                        }
+                    }
+                }
+
+                if( e_eCU_BUNSTF_RES_OK == l_eRes )
+                {
+                    /* The frame must end exactly at the end of the buffer and can't be empty */
+                    if( ( false == l_bEnded ) || ( l_uNExamByte != p_uStuffBufL ) || ( l_uNFillB <= 0u ) )
+                    {
+                        l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                    }
+                    else
+                    {
+                        *p_puDataL = l_uNFillB;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_UnstuffInPlace(uint8_t* p_puBuf, const uint32_t p_uBufL, uint32_t* const p_puDataOff,
+                                           uint32_t* const p_puDataL, uint32_t* const p_puConsumedL)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+    uint32_t l_uSofIdx;
+    uint32_t l_uNExamByte;
+    uint32_t l_uNFillB;
+    uint32_t l_uRunL;
+    uint8_t l_uNegByte;
+    bool_t l_bEnded;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puBuf ) || ( NULL == p_puDataOff ) || ( NULL == p_puDataL ) || ( NULL == p_puConsumedL ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check param */
+        if( p_uBufL <= 0u )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+        }
+        else
+        {
+            l_uSofIdx = eCU_BUNSTF_SkipToSof(NULL, p_puBuf, p_uBufL);
+
+            if( l_uSofIdx >= p_uBufL )
+            {
+                /* No frame at all */
+                l_uNExamByte = p_uBufL;
+                l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+            }
+            else
+            {
+                /* The write index is never after the read index, because every escape sequence write one byte */
+                l_uNExamByte = l_uSofIdx + 1u;
+                l_uNFillB = l_uNExamByte;
+                l_bEnded = false;
+                l_eRes = e_eCU_BUNSTF_RES_OK;
+
+                while( ( l_uNExamByte < p_uBufL ) && ( false == l_bEnded ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) )
+                {
+                    /* Raw data is already in place until the first escape sequence, after that it's moved back */
+                    l_uRunL = eCU_BUNSTF_GetRawRunL(NULL, &p_puBuf[l_uNExamByte], ( p_uBufL - l_uNExamByte ) );
+
+                    if( ( l_uNFillB != l_uNExamByte ) && ( l_uRunL > 0u ) )
+                    {
+                        (void)memmove(&p_puBuf[l_uNFillB], &p_puBuf[l_uNExamByte], l_uRunL);
+                    }
+                    l_uNFillB += l_uRunL;
+                    l_uNExamByte += l_uRunL;
+
+                    /* Elaborate the special byte found */
+                    if( l_uNExamByte < p_uBufL )
+                    {
+                        if( ECU_EOF == p_puBuf[l_uNExamByte] )
+                        {
+                            l_bEnded = true;
+                            l_uNExamByte++;
+                        }
+                        else if( ( ECU_ESC == p_puBuf[l_uNExamByte] ) && ( ( l_uNExamByte + 1u ) < p_uBufL ) &&
+                                 ( ECU_SOF != p_puBuf[l_uNExamByte + 1u] ) )
+                        {
+                            l_uNegByte = ( uint8_t ) ~p_puBuf[l_uNExamByte + 1u];
+
+                            if( ( ECU_SOF != l_uNegByte ) && ( ECU_EOF != l_uNegByte ) && ( ECU_ESC != l_uNegByte ) )
+                            {
+                                /* Impossible receive a data after esc that is not SOF EOF or ESC neg */
+                                l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                            }
+                            else
+                            {
+                                p_puBuf[l_uNFillB] = l_uNegByte;
+                                l_uNFillB++;
+                            }
+
+                            l_uNExamByte += 2u;
+                        }
+                        else if( ECU_ESC == p_puBuf[l_uNExamByte] )
+                        {
+                            /* Escape at the end of the data, or followed by a SOF that is left for the next frame */
+                            l_uNExamByte++;
+                            l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                        }
+                        else
+                        {
+                            /* SOF inside the frame, leave it for the next frame */
+                            l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                        }
+                    }
+                }
+
+                if( e_eCU_BUNSTF_RES_OK == l_eRes )
+                {
+                    /* The frame must be ended and can't be empty */
+                    if( ( false == l_bEnded ) || ( l_uNFillB <= ( l_uSofIdx + 1u ) ) )
+                    {
+                        l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+                    }
+                    else
+                    {
+                        *p_puDataOff = l_uSofIdx + 1u;
+                        *p_puDataL = l_uNFillB - ( l_uSofIdx + 1u );
+                    }
+                }
+            }
+
+            *p_puConsumedL = l_uNExamByte;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTF_RES eCU_BUNSTF_SplitAtSof(const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL,
+                                       uint32_t* const p_puSegStart, const uint32_t p_uNSeg)
+{
+	/* Local variable */
+	e_eCU_BUNSTF_RES l_eRes;
+    uint32_t l_uSegIdx;
+    uint32_t l_uFrom;
+    const uint8_t* l_puSof;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puStuffBuf ) || ( NULL == p_puSegStart ) )
+	{
+		l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check param */
+        if( ( p_uStuffBufL <= 0u ) || ( p_uNSeg <= 0u ) )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+        }
+        else
+        {
+            /* Data before the first SOF is part of the first segment, so nothing is left out */
+            p_puSegStart[0u] = 0u;
+
+            for( l_uSegIdx = 1u; l_uSegIdx < p_uNSeg; l_uSegIdx++ )
+            {
+                /* Search the first SOF after the ideal split point and after the start of the previous segment */
+                l_uFrom = ( p_uStuffBufL / p_uNSeg ) * l_uSegIdx;
+
+                if( l_uFrom <= p_puSegStart[l_uSegIdx - 1u] )
+                {
+                    l_uFrom = p_puSegStart[l_uSegIdx - 1u] + 1u;
+                }
+
+                if( l_uFrom >= p_uStuffBufL )
+                {
+                    p_puSegStart[l_uSegIdx] = p_uStuffBufL;
+                }
+                else
+                {
+                    l_puSof = (const uint8_t*)memchr(&p_puStuffBuf[l_uFrom], (int)ECU_SOF, ( p_uStuffBufL - l_uFrom ) );
+
+                    if( NULL == l_puSof )
+                    {
+                        p_puSegStart[l_uSegIdx] = p_uStuffBufL;
+                    }
+                    else
+                    {
+                        p_puSegStart[l_uSegIdx] = (uint32_t)( l_puSof - p_puStuffBuf );
+                    }
+                }
+            }
+
+            l_eRes = e_eCU_BUNSTF_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_BUNSTF_IsStatusStillCoherent(const t_eCU_BUNSTF_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check basic context validity */
+	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) ||
+        ( ( NULL != p_ptCtx->ptCfg ) && ( false == p_ptCtx->ptCfg->bIsInit ) ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check size validity */
+        if( p_ptCtx->uFrameCtr > p_ptCtx->uBuffL )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            /* Check status coherence */
+            if( ( e_eCU_BUNSTFPRV_SM_NEEDSOF == p_ptCtx->eSM ) && ( 0u != p_ptCtx->uFrameCtr ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                /* Check status coherence */
+                if( ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM ) && ( p_ptCtx->uFrameCtr <= 0u ) )
+                {
+                    l_eRes = false;
+                }
+                else
+                {
+                    l_eRes = true;
+                }
+            }
+
+        }
+	}
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eCU_BUNSTF_UnstufCore(t_eCU_BUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL)
+{
+    /* Local variable */
+    e_eCU_BUNSTF_RES l_eRes;
+    uint32_t l_uNExamByte;
+    uint32_t l_uRunL;
+    uint8_t l_uCurByte;
+    uint8_t l_uClass;
+
+    /* Init counter */
+    l_uNExamByte = 0u;
+
+    /* Init l_eRes */
+    l_eRes = e_eCU_BUNSTF_RES_OK;
+
+    /* Elab all data */
+    while( ( l_uNExamByte < p_uStuffBufL ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ) &&
+           ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND != p_ptCtx->eSM ) &&
+           ( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL != p_ptCtx->eSM ) )
+    {
+        /* Read current byte */
+        l_uCurByte = p_puStuffBuf[l_uNExamByte];
+        l_uClass = eCU_BUNSTF_GetClass(p_ptCtx->ptCfg, l_uCurByte);
+
+        /* Decide what to do */
+        switch( p_ptCtx->eSM )
+        {
+            case e_eCU_BUNSTFPRV_SM_NEEDSOF:
+            {
+                /* Wait SOF, discharge others */
+                if( 0u != ( ECU_BSTFCFG_CLASS_SOF & l_uClass ) )
+                {
+                    /* Found start */
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+                }
+                else
+                {
+                    /* Waiting for start, no other bytes */
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->bEndIsSof = false;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
+                }
+                l_uNExamByte++;
+                break;
+            }
+
+            case e_eCU_BUNSTFPRV_SM_NEEDRAWDATA:
+            {
+                if( ( 0u != ( ECU_BSTFCFG_CLASS_SOF & l_uClass ) ) && ( 0u != ( ECU_BSTFCFG_CLASS_EOF & l_uClass ) ) &&
+                    ( p_ptCtx->uFrameCtr <= 0u ) )
+                {
+                    /* SOF and EOF are the same byte, and consecutive delimiter are only a start of frame */
+                    l_uNExamByte++;
+                }
+                else if( ( 0u != ( ECU_BSTFCFG_CLASS_SOF & l_uClass ) ) &&
+                         ( 0u == ( ECU_BSTFCFG_CLASS_EOF & l_uClass ) ) )
+                {
+                    /* Found start, but wasn't expected */
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+                    l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
+                    l_uNExamByte++;
+                }
+                else if( 0u != ( ECU_BSTFCFG_CLASS_EOF & l_uClass ) )
+                {
+                    /* A delimiter that is also a SOF close this frame and open the next one */
+                    p_ptCtx->bEndIsSof = ( 0u != ( ECU_BSTFCFG_CLASS_SOF & l_uClass ) );
+
+                    if( p_ptCtx->uFrameCtr <= 0u )
+                    {
+                        /* Found end, but no data received..  */
+                        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
+                    }
+                    else if( true == p_ptCtx->bCrcEn )
+                    {
+                        /* The CRC of payload and trailer is zero only if the trailer is the CRC of the payload */
+                        if( ( p_ptCtx->uFrameCtr <= ECU_BUNSTF_CRCL ) || ( 0u != p_ptCtx->uCrc ) )
+                        {
+                            p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
+                        }
+                        else
+                        {
+                            /* Can close the frame, the trailer is not part of the payload */
+                            p_ptCtx->uFrameCtr -= ECU_BUNSTF_CRCL;
+                            p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFEND;
+                        }
+                    }
+                    else
+                    {
+                        /* Can close the frame, yey */
+                        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFEND;
+                    }
+
+                    l_uNExamByte++;
+                }
+                else if( 0u != ( ECU_BSTFCFG_CLASS_ESC & l_uClass ) )
+                {
+                    /* Next data will be negated data */
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDNEGATEDATA;
+                    l_uNExamByte++;
+                }
+                else
+                {
+                    /* Received good raw data */
+                    if( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL )
+                    {
+                        /* No more data avaiable to save that thing */
+                        l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        /* Only raw data, copy all the following raw data together checking the
+                         * avaiable memory only one time */
+                        l_uRunL = eCU_BUNSTF_GetRawRunL(p_ptCtx->ptCfg, &p_puStuffBuf[l_uNExamByte],
+                                                        ( p_uStuffBufL - l_uNExamByte ) );
+                        if( l_uRunL > ( p_ptCtx->uBuffL - p_ptCtx->uFrameCtr ) )
+                        {
+                            /* The exceeding data will generate the out of memory error */
+                            l_uRunL = p_ptCtx->uBuffL - p_ptCtx->uFrameCtr;
+                        }
+
+                        (void)memcpy(&p_ptCtx->puBuff[p_ptCtx->uFrameCtr], &p_puStuffBuf[l_uNExamByte],
+                                     l_uRunL);
+                        if( true == p_ptCtx->bCrcEn )
+                        {
+                            (void)eCU_CRC_32Seed(p_ptCtx->uCrc, &p_puStuffBuf[l_uNExamByte], l_uRunL, &p_ptCtx->uCrc);
+                        }
+                        p_ptCtx->uFrameCtr += l_uRunL;
+                        l_uNExamByte += l_uRunL;
+                    }
+                }
+                break;
+            }
+
+            case e_eCU_BUNSTFPRV_SM_NEEDNEGATEDATA:
+            {
+                if( 0u != ( ECU_BSTFCFG_CLASS_SOF & l_uClass ) )
+                {
+                    /* Found start, but wasn't expected */
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+                    l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
+                    l_uNExamByte++;
+                }
+                else if( ( 0u != ( ECU_BSTFCFG_CLASS_EOF & l_uClass ) ) ||
+                         ( 0u != ( ECU_BSTFCFG_CLASS_ESC & l_uClass ) ) )
+                {
+                    /* Found and error, we were expecting raw negated data here.  */
+                    p_ptCtx->bEndIsSof = false;
+                    p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
+                    l_uNExamByte++;
+                }
+                else
+                {
+                    /* Received negated data */
+                    if( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL )
+                    {
+                        /* No more data avaiable to save that thing */
+                        l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        /* Is it true that negate data is present ? */
+                        if( 0u != ( ( ECU_BSTFCFG_CLASS_ESCVAL | ECU_BSTFCFG_CLASS_RXVAL ) & l_uClass ) )
+                        {
+                            /* current data is neg */
+                            p_ptCtx->puBuff[p_ptCtx->uFrameCtr] = eCU_BUNSTF_XformByte(p_ptCtx->ptCfg, l_uCurByte);
+                            if( true == p_ptCtx->bCrcEn )
+                            {
+                                (void)eCU_CRC_32Seed(p_ptCtx->uCrc, &p_ptCtx->puBuff[p_ptCtx->uFrameCtr], 1u,
+                                                     &p_ptCtx->uCrc);
+                            }
+                            p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+                            p_ptCtx->uFrameCtr++;
+                            l_uNExamByte++;
+                        }
+                        else
+                        {
+                            /* Impossible receive a data after esc that is not SOF EOF or ESC neg */
+                            p_ptCtx->bEndIsSof = false;
+                            p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL;
+                            l_uNExamByte++;
+                        }
+                    }
+                }
+                break;
+            }
+
+            default:
+            {
+                /* Impossible end here, and if so something horrible happened ( memory corruption ) */
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+                break;
+            }
+        }
+    }
+
+    /* Save the l_eRes */
+    *p_puConsumedBufL = l_uNExamByte;
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_FRAMEENDED;
+        }
+        else if( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM )
+        {
+           l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+        }
+        else
+        {
+            /* No error but have other data to unstuff */
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eCU_BUNSTF_SkipToSof(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData, const uint32_t p_uMaxL)
+{
+    uint32_t l_uSkipL;
+    uint8_t l_uSof;
+    const uint8_t* l_puSof;
+
+    /* Only one byte value is a SOF, so the library memchr can be used */
+    if( NULL == p_ptCfg )
+    {
+        l_uSof = ECU_SOF;
+    }
+    else
+    {
+        l_uSof = p_ptCfg->uSof;
+    }
+
+    l_puSof = (const uint8_t*)memchr(p_puData, (int)l_uSof, p_uMaxL);
+
+    if( NULL == l_puSof )
+    {
+        l_uSkipL = p_uMaxL;
+    }
+    else
+    {
+        l_uSkipL = (uint32_t)( l_puSof - p_puData );
+    }
+
+    return l_uSkipL;
+}
+
+static uint32_t eCU_BUNSTF_GetRawRunL(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t* p_puData,
+                                      const uint32_t p_uMaxL)
+{
+    uint32_t l_uRunL;
+
+    l_uRunL = 0u;
+
+    if( NULL == p_ptCfg )
+    {
+        /* Check four byte for every iteration, most of the received byte are raw data */
+        l_uRunL = eCU_STFPRV_GetNonDelimRunL(p_puData, p_uMaxL, ECU_SOF, ECU_EOF, ECU_ESC);
+    }
+    else
+    {
+        /* Every byte is classified with the lookup table of the configuration */
+        while( ( l_uRunL < p_uMaxL ) &&
+               ( 0u == ( ( ECU_BSTFCFG_CLASS_SOF | ECU_BSTFCFG_CLASS_EOF | ECU_BSTFCFG_CLASS_ESC ) &
+                         p_ptCfg->auClass[p_puData[l_uRunL]] ) ) )
+        {
+            l_uRunL++;
+        }
+    }
+
+    return l_uRunL;
+}
+
+static uint8_t eCU_BUNSTF_GetClass(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte)
+{
+    uint8_t l_uClass;
+    uint8_t l_uNegByte;
+
+    if( NULL == p_ptCfg )
+    {
+        /* Default delimiter, a byte after ESC is valid only if it's a negated delimiter */
+        l_uNegByte = ( uint8_t ) ~p_uByte;
+        l_uClass = 0u;
+
+        if( ECU_SOF == p_uByte )
+        {
+            l_uClass |= ECU_BSTFCFG_CLASS_SOF;
+        }
+
+        if( ECU_EOF == p_uByte )
+        {
+            l_uClass |= ECU_BSTFCFG_CLASS_EOF;
+        }
+
+        if( ECU_ESC == p_uByte )
+        {
+            l_uClass |= ECU_BSTFCFG_CLASS_ESC;
+        }
+
+        if( ( ECU_SOF == l_uNegByte ) || ( ECU_EOF == l_uNegByte ) || ( ECU_ESC == l_uNegByte ) )
+        {
+            l_uClass |= ECU_BSTFCFG_CLASS_ESCVAL;
+        }
+    }
+    else
+    {
+        l_uClass = p_ptCfg->auClass[p_uByte];
+    }
+
+    return l_uClass;
+}
+
+static uint8_t eCU_BUNSTF_XformByte(const t_eCU_BSTFCFG_Ctx* p_ptCfg, const uint8_t p_uByte)
+{
+    uint8_t l_uRes;
+
+    if( NULL == p_ptCfg )
+    {
+        l_uRes = ( uint8_t ) ~p_uByte;
+    }
+    else
+    {
+        l_uRes = p_ptCfg->auXform[p_uByte];
+    }
+
+    return l_uRes;
+}
+
+static void eCU_BUNSTF_Rearm(t_eCU_BUNSTF_Ctx* const p_ptCtx)
+{
+    if( ( true == p_ptCtx->bEndIsSof ) && ( ( e_eCU_BUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM ) ||
+                                            ( e_eCU_BUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM ) ) )
+    {
+        /* The delimiter that closed the last frame is also the start of the next one */
+        p_ptCtx->uCrc = eCU_CRC_BASE_SEED;
+        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+    }
+    else
+    {
+        p_ptCtx->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
+    }
+
+    p_ptCtx->bEndIsSof = false;
+}
+
+static e_eCU_BUNSTF_RES eCU_BUNSTF_ConvertCirqRes(const e_eCU_CIRQ_RES p_eCirqRes)
+{
+    e_eCU_BUNSTF_RES l_eRes;
+
+    switch( p_eCirqRes )
+    {
+        case e_eCU_CIRQ_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            break;
+        }
+
+        default:
+        {
+            /* Bad pointer, bad parameter or empty queue, the queue can't be used as expected */
+            l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+            break;
+        }
+    }
 
     return l_eRes;
 }
\ No newline at end of file
@@ -0,0 +1,621 @@
+/**
+ * @file       eCU_BUNSTFMC.c
+ *
+ * @brief      Multi channel byte unstuffer utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_BUNSTFMC.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_BUNSTFMC_IsStatusStillCoherent(const t_eCU_BUNSTFMC_Ctx* p_ptCtx);
+static bool_t eCU_BUNSTFMC_IsChanStillCoherent(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const t_eCU_BUNSTFMC_Chan* p_ptChan);
+static uint8_t* eCU_BUNSTFMC_GetBuff(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint32_t p_uBuffIdx);
+static uint32_t eCU_BUNSTFMC_PopBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx);
+static void eCU_BUNSTFMC_PushBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint32_t p_uBuffIdx);
+static void eCU_BUNSTFMC_ResetChan(t_eCU_BUNSTFMC_Chan* const p_ptChan);
+static bool_t eCU_BUNSTFMC_IsUserOwn(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint32_t p_uBuffIdx);
+static void eCU_BUNSTFMC_SetUserOwn(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint32_t p_uBuffIdx, const bool_t p_bOwn);
+static uint32_t eCU_BUNSTFMC_SkipToSof(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint8_t* p_puData,
+                                       const uint32_t p_uMaxL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InitCtx(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, uint8_t* p_puPool, const uint32_t p_uPoolL,
+                                        const uint32_t p_uFrameL)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+    uint32_t l_uBuffIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puPool ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity, at least one frame buffer must be present */
+        if( ( p_uFrameL < ECU_BUNSTFMC_MINFRAMEL ) || ( p_uPoolL < p_uFrameL ) ||
+            ( ( p_uPoolL / p_uFrameL ) > ECU_BUNSTFMC_MAXBUFF ) )
+        {
+            l_eRes = e_eCU_BUNSTFMC_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status variable */
+            p_ptCtx->puPool = p_puPool;
+            p_ptCtx->uFrameL = p_uFrameL;
+            p_ptCtx->uNBuff = p_uPoolL / p_uFrameL;
+            p_ptCtx->uFreeHead = ECU_BUNSTFMC_NOBUFF;
+            p_ptCtx->uNFree = 0u;
+            p_ptCtx->ptCfg = NULL;
+            (void)memset(p_ptCtx->auUserOwn, 0, sizeof(p_ptCtx->auUserOwn));
+
+            /* Every frame buffer is free, the first one will be the first given */
+            for( l_uBuffIdx = p_ptCtx->uNBuff; l_uBuffIdx > 0u; l_uBuffIdx-- )
+            {
+                eCU_BUNSTFMC_PushBuff(p_ptCtx, ( l_uBuffIdx - 1u ) );
+            }
+
+            p_ptCtx->bIsInit = true;
+
+            /* All ok */
+            l_eRes = e_eCU_BUNSTFMC_RES_OK;
+        }
+    }
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_IsInit(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_BUNSTFMC_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_SetCfg(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const t_eCU_BSTFCFG_Ctx* p_ptCfg)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCfg ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( false == p_ptCfg->bIsInit )
+                {
+                    l_eRes = e_eCU_BUNSTFMC_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->ptCfg = p_ptCfg;
+                    l_eRes = e_eCU_BUNSTFMC_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InitChan(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptChan ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                eCU_BUNSTFMC_ResetChan(p_ptChan);
+                l_eRes = e_eCU_BUNSTFMC_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_CloseChan(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptChan ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) ) ||
+                ( false == eCU_BUNSTFMC_IsChanStillCoherent(p_ptCtx, p_ptChan) ) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Give back the frame buffer of the frame in progress */
+                if( ECU_BUNSTFMC_NOBUFF != p_ptChan->uBuffIdx )
+                {
+                    eCU_BUNSTFMC_PushBuff(p_ptCtx, p_ptChan->uBuffIdx);
+                }
+
+                eCU_BUNSTFMC_ResetChan(p_ptChan);
+                l_eRes = e_eCU_BUNSTFMC_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_InsStufChunk(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, t_eCU_BUNSTFMC_Chan* const p_ptChan,
+                                             const uint8_t* p_puStuffBuf, const uint32_t p_uStuffBufL,
+                                             uint32_t* const p_puConsumedBufL, uint8_t** p_ppuFrame,
+                                             uint32_t* const p_puFrameL)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+    e_eCU_BUNSTF_RES l_eUnstufRes;
+    t_eCU_BUNSTF_Ctx l_tUnstf;
+    uint32_t l_uNExamByte;
+    uint32_t l_uConsumed;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptChan ) || ( NULL == p_puStuffBuf ) || ( NULL == p_puConsumedBufL ) ||
+        ( NULL == p_ppuFrame ) || ( NULL == p_puFrameL ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) ) ||
+                ( false == eCU_BUNSTFMC_IsChanStillCoherent(p_ptCtx, p_ptChan) ) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( p_uStuffBufL <= 0u )
+                {
+                    l_eRes = e_eCU_BUNSTFMC_RES_BADPARAM;
+                }
+                else
+                {
+                    l_uNExamByte = 0u;
+                    l_eRes = e_eCU_BUNSTFMC_RES_OK;
+
+                    while( ( l_uNExamByte < p_uStuffBufL ) && ( e_eCU_BUNSTFMC_RES_OK == l_eRes ) )
+                    {
+                        if( ECU_BUNSTFMC_NOBUFF == p_ptChan->uBuffIdx )
+                        {
+                            /* Without a frame in progress no memory is needed, discharge everything until a SOF */
+                            l_uNExamByte += eCU_BUNSTFMC_SkipToSof(p_ptCtx, &p_puStuffBuf[l_uNExamByte],
+                                                                   ( p_uStuffBufL - l_uNExamByte ) );
+
+                            if( l_uNExamByte < p_uStuffBufL )
+                            {
+                                if( p_ptCtx->uNFree <= 0u )
+                                {
+                                    /* The SOF is left for the next call */
+                                    l_eRes = e_eCU_BUNSTFMC_RES_NOFREEBUFF;
+                                }
+                                else
+                                {
+                                    p_ptChan->uBuffIdx = eCU_BUNSTFMC_PopBuff(p_ptCtx);
+                                    p_ptChan->uFrameCtr = 0u;
+                                    p_ptChan->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
+                                }
+                            }
+                        }
+
+                        if( ( e_eCU_BUNSTFMC_RES_OK == l_eRes ) && ( l_uNExamByte < p_uStuffBufL ) )
+                        {
+                            /* Load the channel in a byte unstuffer working on the borrowed frame buffer */
+                            l_tUnstf.bIsInit = true;
+                            l_tUnstf.puBuff = eCU_BUNSTFMC_GetBuff(p_ptCtx, p_ptChan->uBuffIdx);
+                            l_tUnstf.uBuffL = p_ptCtx->uFrameL;
+                            l_tUnstf.uFrameCtr = p_ptChan->uFrameCtr;
+                            l_tUnstf.bCrcEn = false;
+                            l_tUnstf.uCrc = 0u;
+                            l_tUnstf.ptCfg = p_ptCtx->ptCfg;
+                            l_tUnstf.bHuntEn = false;
+                            l_tUnstf.uSkipL = 0u;
+                            l_tUnstf.bEndIsSof = false;
+                            l_tUnstf.eSM = p_ptChan->eSM;
+
+                            l_eUnstufRes = eCU_BUNSTF_InsStufChunk(&l_tUnstf, &p_puStuffBuf[l_uNExamByte],
+                                                                   ( p_uStuffBufL - l_uNExamByte ), &l_uConsumed);
+                            l_uNExamByte += l_uConsumed;
+                            p_ptChan->uFrameCtr = l_tUnstf.uFrameCtr;
+                            p_ptChan->eSM = l_tUnstf.eSM;
+
+                            switch( l_eUnstufRes )
+                            {
+                                case e_eCU_BUNSTF_RES_OK:
+                                case e_eCU_BUNSTF_RES_FRAMERESTART:
+                                {
+                                    /* Frame still ongoing, or already restarted in the same buffer */
+                                    break;
+                                }
+
+                                case e_eCU_BUNSTF_RES_FRAMEENDED:
+                                {
+                                    /* Hand over the frame buffer, the channel doesn't own it anymore */
+                                    eCU_BUNSTFMC_SetUserOwn(p_ptCtx, p_ptChan->uBuffIdx, true);
+                                    *p_ppuFrame = l_tUnstf.puBuff;
+                                    *p_puFrameL = l_tUnstf.uFrameCtr;
+                                    eCU_BUNSTFMC_ResetChan(p_ptChan);
+                                    l_eRes = e_eCU_BUNSTFMC_RES_FRAMEENDED;
+
+                                    if( true == l_tUnstf.bEndIsSof )
+                                    {
+                                        /* The flag that closed the frame is also the start of the next one */
+                                        if( p_ptCtx->uNFree > 0u )
+                                        {
+                                            p_ptChan->uBuffIdx = eCU_BUNSTFMC_PopBuff(p_ptCtx);
+                                            p_ptChan->eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+                                        }
+                                        else
+                                        {
+                                            /* Without a free buffer the flag is left for the next call */
+                                            l_uNExamByte--;
+                                        }
+                                    }
+                                    break;
+                                }
+
+                                case e_eCU_BUNSTF_RES_BADFRAME:
+                                {
+                                    eCU_BUNSTFMC_PushBuff(p_ptCtx, p_ptChan->uBuffIdx);
+                                    eCU_BUNSTFMC_ResetChan(p_ptChan);
+                                    l_eRes = e_eCU_BUNSTFMC_RES_BADFRAME;
+                                    break;
+                                }
+
+                                case e_eCU_BUNSTF_RES_OUTOFMEM:
+                                {
+                                    /* The rest of the frame will be discharged waiting the next SOF */
+                                    eCU_BUNSTFMC_PushBuff(p_ptCtx, p_ptChan->uBuffIdx);
+                                    eCU_BUNSTFMC_ResetChan(p_ptChan);
+                                    l_eRes = e_eCU_BUNSTFMC_RES_OUTOFMEM;
+                                    break;
+                                }
+
+                                default:
+                                {
+                                    /* Impossible end here */
+                                    l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    *p_puConsumedBufL = l_uNExamByte;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_RelFrame(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint8_t* p_puFrame)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+    uint32_t l_uOffset;
+    uint32_t l_uBuffIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrame ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param, the frame must be inside the pool before computing his offset */
+                if( ( p_puFrame < p_ptCtx->puPool ) ||
+                    ( p_puFrame >= &p_ptCtx->puPool[p_ptCtx->uNBuff * p_ptCtx->uFrameL] ) )
+                {
+                    l_eRes = e_eCU_BUNSTFMC_RES_BADPARAM;
+                }
+                else
+                {
+                    l_uOffset = (uint32_t)( p_puFrame - p_ptCtx->puPool );
+                    l_uBuffIdx = l_uOffset / p_ptCtx->uFrameL;
+
+                    /* Must be the start of a buffer given to the caller and not released yet */
+                    if( ( 0u != ( l_uOffset % p_ptCtx->uFrameL ) ) ||
+                        ( false == eCU_BUNSTFMC_IsUserOwn(p_ptCtx, l_uBuffIdx) ) )
+                    {
+                        l_eRes = e_eCU_BUNSTFMC_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        eCU_BUNSTFMC_SetUserOwn(p_ptCtx, l_uBuffIdx, false);
+                        eCU_BUNSTFMC_PushBuff(p_ptCtx, l_uBuffIdx);
+                        l_eRes = e_eCU_BUNSTFMC_RES_OK;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_BUNSTFMC_RES eCU_BUNSTFMC_GetFreeBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, uint32_t* const p_puNFree)
+{
+	/* Local variable */
+	e_eCU_BUNSTFMC_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puNFree ) )
+	{
+		l_eRes = e_eCU_BUNSTFMC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_BUNSTFMC_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_BUNSTFMC_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_BUNSTFMC_RES_CORRUPTCTX;
+            }
+            else
+            {
+                *p_puNFree = p_ptCtx->uNFree;
+                l_eRes = e_eCU_BUNSTFMC_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_BUNSTFMC_IsStatusStillCoherent(const t_eCU_BUNSTFMC_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check basic context validity */
+	if( ( NULL == p_ptCtx->puPool ) || ( p_ptCtx->uFrameL < ECU_BUNSTFMC_MINFRAMEL ) || ( p_ptCtx->uNBuff <= 0u ) ||
+        ( p_ptCtx->uNBuff > ECU_BUNSTFMC_MAXBUFF ) ||
+        ( ( NULL != p_ptCtx->ptCfg ) && ( false == p_ptCtx->ptCfg->bIsInit ) ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check free list validity */
+        if( ( p_ptCtx->uNFree > p_ptCtx->uNBuff ) ||
+            ( ( p_ptCtx->uNFree <= 0u ) && ( ECU_BUNSTFMC_NOBUFF != p_ptCtx->uFreeHead ) ) ||
+            ( ( p_ptCtx->uNFree > 0u ) && ( p_ptCtx->uFreeHead >= p_ptCtx->uNBuff ) ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+	}
+
+    return l_eRes;
+}
+
+static bool_t eCU_BUNSTFMC_IsChanStillCoherent(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const t_eCU_BUNSTFMC_Chan* p_ptChan)
+{
+    bool_t l_eRes;
+
+    if( ECU_BUNSTFMC_NOBUFF == p_ptChan->uBuffIdx )
+    {
+        /* A channel without buffer can only wait the SOF */
+        if( ( e_eCU_BUNSTFPRV_SM_NEEDSOF != p_ptChan->eSM ) || ( 0u != p_ptChan->uFrameCtr ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+    }
+    else
+    {
+        /* A channel with a buffer is always in the middle of a frame */
+        if( ( p_ptChan->uBuffIdx >= p_ptCtx->uNBuff ) || ( p_ptChan->uFrameCtr > p_ptCtx->uFrameL ) ||
+            ( ( e_eCU_BUNSTFPRV_SM_NEEDRAWDATA != p_ptChan->eSM ) &&
+              ( e_eCU_BUNSTFPRV_SM_NEEDNEGATEDATA != p_ptChan->eSM ) ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint8_t* eCU_BUNSTFMC_GetBuff(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint32_t p_uBuffIdx)
+{
+    return &p_ptCtx->puPool[p_uBuffIdx * p_ptCtx->uFrameL];
+}
+
+static uint32_t eCU_BUNSTFMC_PopBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx)
+{
+    uint32_t l_uBuffIdx;
+
+    /* The index of the next free buffer is stored at the start of the free buffer itself */
+    l_uBuffIdx = p_ptCtx->uFreeHead;
+    (void)memcpy(&p_ptCtx->uFreeHead, eCU_BUNSTFMC_GetBuff(p_ptCtx, l_uBuffIdx), sizeof(p_ptCtx->uFreeHead));
+    p_ptCtx->uNFree--;
+
+    return l_uBuffIdx;
+}
+
+static void eCU_BUNSTFMC_PushBuff(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint32_t p_uBuffIdx)
+{
+    (void)memcpy(eCU_BUNSTFMC_GetBuff(p_ptCtx, p_uBuffIdx), &p_ptCtx->uFreeHead, sizeof(p_ptCtx->uFreeHead));
+    p_ptCtx->uFreeHead = p_uBuffIdx;
+    p_ptCtx->uNFree++;
+}
+
+static void eCU_BUNSTFMC_ResetChan(t_eCU_BUNSTFMC_Chan* const p_ptChan)
+{
+    p_ptChan->uBuffIdx = ECU_BUNSTFMC_NOBUFF;
+    p_ptChan->uFrameCtr = 0u;
+    p_ptChan->eSM = e_eCU_BUNSTFPRV_SM_NEEDSOF;
+}
+
+static bool_t eCU_BUNSTFMC_IsUserOwn(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint32_t p_uBuffIdx)
+{
+    return ( 0u != ( p_ptCtx->auUserOwn[p_uBuffIdx / 8u] & ( 1u << ( p_uBuffIdx % 8u ) ) ) );
+}
+
+static void eCU_BUNSTFMC_SetUserOwn(t_eCU_BUNSTFMC_Ctx* const p_ptCtx, const uint32_t p_uBuffIdx, const bool_t p_bOwn)
+{
+    if( true == p_bOwn )
+    {
+        p_ptCtx->auUserOwn[p_uBuffIdx / 8u] |= (uint8_t)( 1u << ( p_uBuffIdx % 8u ) );
+    }
+    else
+    {
+        p_ptCtx->auUserOwn[p_uBuffIdx / 8u] &= (uint8_t)( ~( 1u << ( p_uBuffIdx % 8u ) ) );
+    }
+}
+
+static uint32_t eCU_BUNSTFMC_SkipToSof(const t_eCU_BUNSTFMC_Ctx* p_ptCtx, const uint8_t* p_puData,
+                                       const uint32_t p_uMaxL)
+{
+    uint32_t l_uSkipL;
+    uint8_t l_uSof;
+    const uint8_t* l_puSof;
+
+    if( NULL == p_ptCtx->ptCfg )
+    {
+        l_uSof = ECU_SOF;
+    }
+    else
+    {
+        l_uSof = p_ptCtx->ptCfg->uSof;
+    }
+
+    l_puSof = (const uint8_t*)memchr(p_puData, (int)l_uSof, p_uMaxL);
+
+    if( NULL == l_puSof )
+    {
+        l_uSkipL = p_uMaxL;
+    }
+    else
+    {
+        l_uSkipL = (uint32_t)( l_puSof - p_puData );
+    }
+
+    return l_uSkipL;
+}
\ No newline at end of file
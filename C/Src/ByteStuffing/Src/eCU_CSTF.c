@@ -0,0 +1,556 @@
+/**
+ * @file       eCU_CSTF.c
+ *
+ * @brief      COBS byte stuffer utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CSTF.h"
+#include "eCU_STFPRV.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_CSTF_IsStatusStillCoherent(const t_eCU_CSTF_Ctx* p_ptCtx);
+static uint32_t eCU_CSTF_CalcRemL(const t_eCU_CSTF_Ctx* p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_CSTF_RES eCU_CSTF_InitCtx(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL <= 0u )
+        {
+            l_eRes = e_eCU_CSTF_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->bIsInit = true;
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uFrameL = 0u;
+            p_ptCtx->uFrameCtr = 0u;
+            p_ptCtx->uBlockRem = 0u;
+            p_ptCtx->bBlockFull = false;
+            p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDCODE;
+
+            l_eRes = e_eCU_CSTF_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_IsInit(t_eCU_CSTF_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_CSTF_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_GetWherePutData(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puMaxL)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puMaxL ) )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* return data */
+                *p_ppuData = p_ptCtx->puBuff;
+                *p_puMaxL = p_ptCtx->uBuffL;
+                l_eRes = e_eCU_CSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_NewFrame(t_eCU_CSTF_Ctx* const p_ptCtx, const uint32_t p_uFrameL)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity */
+                if( ( p_uFrameL <= 0u ) || ( p_uFrameL > p_ptCtx->uBuffL ) )
+                {
+                    l_eRes = e_eCU_CSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Update data */
+                    p_ptCtx->uFrameL = p_uFrameL;
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uBlockRem = 0u;
+                    p_ptCtx->bBlockFull = false;
+                    p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDCODE;
+
+                    l_eRes = e_eCU_CSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_RestartFrame(t_eCU_CSTF_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Param */
+                if( p_ptCtx->uFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_CSTF_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Update index */
+                    p_ptCtx->uFrameCtr = 0u;
+                    p_ptCtx->uBlockRem = 0u;
+                    p_ptCtx->bBlockFull = false;
+                    p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDCODE;
+
+                    l_eRes = e_eCU_CSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_GetRemByteToGet(t_eCU_CSTF_Ctx* const p_ptCtx, uint32_t* const p_puGettedL)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puGettedL ) )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( p_ptCtx->uFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_CSTF_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Copy calc value */
+                    *p_puGettedL = eCU_CSTF_CalcRemL(p_ptCtx);
+
+                    l_eRes = e_eCU_CSTF_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CSTF_RES eCU_CSTF_GetStufChunk(t_eCU_CSTF_Ctx* const p_ptCtx, uint8_t* p_puStuffedBuf, const uint32_t p_uMaxBufL,
+                                     uint32_t* const p_puGettedL)
+{
+	/* Local variable */
+	e_eCU_CSTF_RES l_eRes;
+    uint32_t l_uNFillB;
+    uint32_t l_uRunL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puStuffedBuf ) || ( NULL == p_puGettedL ) )
+	{
+		l_eRes = e_eCU_CSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( p_ptCtx->uFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_CSTF_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Check param */
+                    if( p_uMaxBufL <= 0u )
+                    {
+                        l_eRes = e_eCU_CSTF_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Init counter */
+                        l_uNFillB = 0u;
+                        l_eRes = e_eCU_CSTF_RES_OK;
+
+                        /* Execute parsing cycle */
+                        while( ( l_uNFillB < p_uMaxBufL ) && ( e_eCU_CSTFPRV_SM_STUFFEND != p_ptCtx->eSM ) &&
+                               ( e_eCU_CSTF_RES_OK == l_eRes ) )
+                        {
+                            switch( p_ptCtx->eSM )
+                            {
+                                case e_eCU_CSTFPRV_SM_NEEDCODE :
+                                {
+                                    if( ( p_ptCtx->uFrameCtr >= p_ptCtx->uFrameL ) && ( true == p_ptCtx->bBlockFull ) )
+                                    {
+                                        /* The last block was full and ended with the frame, no more block needed */
+                                        p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDEOF;
+                                    }
+                                    else
+                                    {
+                                        /* The code is the number of non zero byte that follow, plus one */
+                                        l_uRunL = p_ptCtx->uFrameL - p_ptCtx->uFrameCtr;
+                                        if( l_uRunL > ECU_CSTF_MAXBLOCKL )
+                                        {
+                                            l_uRunL = ECU_CSTF_MAXBLOCKL;
+                                        }
+
+                                        l_uRunL = eCU_STFPRV_GetNonZeroRunL(&p_ptCtx->puBuff[p_ptCtx->uFrameCtr],
+                                                                            l_uRunL);
+                                        p_puStuffedBuf[l_uNFillB] = (uint8_t)( l_uRunL + 1u );
+                                        l_uNFillB++;
+
+                                        p_ptCtx->uBlockRem = l_uRunL;
+                                        p_ptCtx->bBlockFull = ( ECU_CSTF_MAXBLOCKL == l_uRunL );
+                                        p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDDATA;
+                                    }
+
+                                    break;
+                                }
+
+                                case e_eCU_CSTFPRV_SM_NEEDDATA :
+                                {
+                                    if( p_ptCtx->uBlockRem > 0u )
+                                    {
+                                        /* Copy all the data of the block that fit the destination */
+                                        l_uRunL = p_ptCtx->uBlockRem;
+                                        if( l_uRunL > ( p_uMaxBufL - l_uNFillB ) )
+                                        {
+                                            l_uRunL = p_uMaxBufL - l_uNFillB;
+                                        }
+
+                                        (void)memcpy(&p_puStuffedBuf[l_uNFillB],
+                                                     &p_ptCtx->puBuff[p_ptCtx->uFrameCtr], l_uRunL);
+                                        l_uNFillB += l_uRunL;
+                                        p_ptCtx->uFrameCtr += l_uRunL;
+                                        p_ptCtx->uBlockRem -= l_uRunL;
+                                    }
+                                    else if( true == p_ptCtx->bBlockFull )
+                                    {
+                                        /* A full block doesn't end with a zero */
+                                        p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDCODE;
+                                    }
+                                    else if( p_ptCtx->uFrameCtr < p_ptCtx->uFrameL )
+                                    {
+                                        /* The block ended with a zero, that is implicit in the code */
+                                        p_ptCtx->uFrameCtr++;
+                                        p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDCODE;
+                                    }
+                                    else
+                                    {
+                                        /* The block ended with the frame */
+                                        p_ptCtx->eSM = e_eCU_CSTFPRV_SM_NEEDEOF;
+                                    }
+
+                                    break;
+                                }
+
+                                case e_eCU_CSTFPRV_SM_NEEDEOF :
+                                {
+                                    /* End of frame */
+                                    p_puStuffedBuf[l_uNFillB] = ECU_CSTF_EOF;
+                                    p_ptCtx->eSM = e_eCU_CSTFPRV_SM_STUFFEND;
+                                    l_uNFillB++;
+
+                                    break;
+                                }
+
+                                default:
+                                {
+                                    /* Impossible end here, and if so something horrible happened (memory corruption) */
+                                    l_eRes = e_eCU_CSTF_RES_CORRUPTCTX;
+                                    break;
+                                }
+                            }
+                        }
+
+                        /* Save counter */
+                        *p_puGettedL = l_uNFillB;
+
+                        if( e_eCU_CSTF_RES_OK == l_eRes )
+                        {
+                            if( e_eCU_CSTFPRV_SM_STUFFEND == p_ptCtx->eSM )
+                            {
+                                /* Nothing more */
+                                l_eRes = e_eCU_CSTF_RES_FRAMEENDED;
+                            }
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_CSTF_IsStatusStillCoherent(const t_eCU_CSTF_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check basic context validity */
+	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check context limit validity */
+        if( ( p_ptCtx->uFrameL > p_ptCtx->uBuffL ) || ( p_ptCtx->uFrameCtr > p_ptCtx->uFrameL ) ||
+            ( p_ptCtx->uBlockRem > ECU_CSTF_MAXBLOCKL ) ||
+            ( p_ptCtx->uBlockRem > ( p_ptCtx->uFrameL - p_ptCtx->uFrameCtr ) ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            /* Only a block that is being copied can have remaining data */
+            if( ( e_eCU_CSTFPRV_SM_NEEDDATA != p_ptCtx->eSM ) && ( 0u != p_ptCtx->uBlockRem ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                /* Check data coherence on EOF */
+                if( ( ( e_eCU_CSTFPRV_SM_STUFFEND == p_ptCtx->eSM ) || ( e_eCU_CSTFPRV_SM_NEEDEOF == p_ptCtx->eSM ) ) &&
+                    ( p_ptCtx->uFrameCtr != p_ptCtx->uFrameL ) )
+                {
+                    l_eRes = false;
+                }
+                else
+                {
+                    l_eRes = true;
+                }
+            }
+        }
+	}
+
+    return l_eRes;
+}
+
+static uint32_t eCU_CSTF_CalcRemL(const t_eCU_CSTF_Ctx* p_ptCtx)
+{
+    uint32_t l_uRemL;
+    uint32_t l_uCtr;
+    uint32_t l_uRunL;
+    bool_t l_bBlockFull;
+    bool_t l_bEnded;
+
+    l_uRemL = 0u;
+    l_bEnded = false;
+    l_uCtr = p_ptCtx->uFrameCtr;
+    l_bBlockFull = p_ptCtx->bBlockFull;
+
+    if( e_eCU_CSTFPRV_SM_STUFFEND == p_ptCtx->eSM )
+    {
+        /* Nothing more to retrive */
+        l_bEnded = true;
+    }
+    else if( e_eCU_CSTFPRV_SM_NEEDEOF == p_ptCtx->eSM )
+    {
+        /* Only the EOF */
+        l_uRemL = 1u;
+        l_bEnded = true;
+    }
+    else if( e_eCU_CSTFPRV_SM_NEEDDATA == p_ptCtx->eSM )
+    {
+        /* Finish the current block, and consume the implicit zero if present */
+        l_uRemL = p_ptCtx->uBlockRem;
+        l_uCtr += p_ptCtx->uBlockRem;
+
+        if( false == l_bBlockFull )
+        {
+            if( l_uCtr < p_ptCtx->uFrameL )
+            {
+                l_uCtr++;
+            }
+            else
+            {
+                l_uRemL++;
+                l_bEnded = true;
+            }
+        }
+    }
+    else
+    {
+        /* Need a code */
+    }
+
+    /* Simulate the remaining blocks. Stuffed lenght is always lower than 0xFFFFFFFF for a frame that fit in memory */
+    while( false == l_bEnded )
+    {
+        if( ( l_uCtr >= p_ptCtx->uFrameL ) && ( true == l_bBlockFull ) )
+        {
+            /* Only the EOF */
+            l_uRemL++;
+            l_bEnded = true;
+        }
+        else
+        {
+            l_uRunL = p_ptCtx->uFrameL - l_uCtr;
+            if( l_uRunL > ECU_CSTF_MAXBLOCKL )
+            {
+                l_uRunL = ECU_CSTF_MAXBLOCKL;
+            }
+
+            l_uRunL = eCU_STFPRV_GetNonZeroRunL(&p_ptCtx->puBuff[l_uCtr], l_uRunL);
+            l_uRemL += ( l_uRunL + 1u );
+            l_uCtr += l_uRunL;
+            l_bBlockFull = ( ECU_CSTF_MAXBLOCKL == l_uRunL );
+
+            if( false == l_bBlockFull )
+            {
+                if( l_uCtr < p_ptCtx->uFrameL )
+                {
+                    l_uCtr++;
+                }
+                else
+                {
+                    l_uRemL++;
+                    l_bEnded = true;
+                }
+            }
+        }
+    }
+
+    return l_uRemL;
+}
\ No newline at end of file
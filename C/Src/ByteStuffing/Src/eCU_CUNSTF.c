@@ -0,0 +1,532 @@
+/**
+ * @file       eCU_CUNSTF.c
+ *
+ * @brief      COBS byte unstuffer utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CUNSTF.h"
+#include "eCU_STFPRV.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINES
+ **********************************************************************************************************************/
+/* Value used as end of frame, it never appear inside a stuffed frame */
+#define ECU_CUNSTF_EOF                                                                             ( ( uint8_t ) 0x00u )
+
+/* Code of a block of 254 byte, the only block that is not followed by an implicit zero */
+#define ECU_CUNSTF_FULLBLOCKCODE                                                                   ( ( uint8_t ) 0xFFu )
+
+/* Max number of payload byte that a single block can contain */
+#define ECU_CUNSTF_MAXBLOCKL                                                                       ( ( uint32_t ) 254u )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_CUNSTF_IsStatusStillCoherent(const t_eCU_CUNSTF_Ctx* p_ptCtx);
+static e_eCU_CUNSTF_RES eCU_CUNSTF_UnstufCore(t_eCU_CUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_CUNSTF_RES eCU_CUNSTF_InitCtx(t_eCU_CUNSTF_Ctx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL <= 0u )
+        {
+            l_eRes = e_eCU_CUNSTF_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->bIsInit = true;
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uFrameCtr = 0u;
+            p_ptCtx->uBlockRem = 0u;
+            p_ptCtx->bPendZero = false;
+            p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_NEEDCODE;
+            l_eRes = e_eCU_CUNSTF_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_IsInit(t_eCU_CUNSTF_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_CUNSTF_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_NewFrame(t_eCU_CUNSTF_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Update index */
+                p_ptCtx->uFrameCtr = 0u;
+                p_ptCtx->uBlockRem = 0u;
+                p_ptCtx->bPendZero = false;
+                p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_NEEDCODE;
+
+                l_eRes = e_eCU_CUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_GetUnstufData(t_eCU_CUNSTF_Ctx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puL)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puL ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                *p_ppuData = p_ptCtx->puBuff;
+                *p_puL =  p_ptCtx->uFrameCtr;
+                l_eRes = e_eCU_CUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_GetUnstufLen(t_eCU_CUNSTF_Ctx* const p_ptCtx, uint32_t* const p_puL)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puL ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                *p_puL =  p_ptCtx->uFrameCtr;
+                l_eRes = e_eCU_CUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_IsAFullFrameUnstuff(const t_eCU_CUNSTF_Ctx* p_ptCtx, bool_t* const p_pbIsFrameUnstuff)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsFrameUnstuff ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                if( e_eCU_CUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM )
+                {
+                    *p_pbIsFrameUnstuff = true;
+                }
+                else
+                {
+                    *p_pbIsFrameUnstuff = false;
+                }
+                l_eRes = e_eCU_CUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_IsFrameBad(const t_eCU_CUNSTF_Ctx* p_ptCtx, bool_t* const p_pbIsFrameBad)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsFrameBad ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                if( e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM )
+                {
+                    *p_pbIsFrameBad = true;
+                }
+                else
+                {
+                    *p_pbIsFrameBad = false;
+                }
+                l_eRes = e_eCU_CUNSTF_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CUNSTF_RES eCU_CUNSTF_InsStufChunk(t_eCU_CUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                         const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL)
+{
+	/* Local variable */
+	e_eCU_CUNSTF_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puStuffBuf ) || ( NULL == p_puConsumedBufL ) )
+	{
+		l_eRes = e_eCU_CUNSTF_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CUNSTF_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_CUNSTF_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param */
+                if( p_uStuffBufL <= 0u )
+                {
+                    l_eRes = e_eCU_CUNSTF_RES_BADPARAM;
+                }
+                else
+                {
+                    l_eRes = eCU_CUNSTF_UnstufCore(p_ptCtx, p_puStuffBuf, p_uStuffBufL, p_puConsumedBufL);
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_CUNSTF_IsStatusStillCoherent(const t_eCU_CUNSTF_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check basic context validity */
+	if( ( p_ptCtx->uBuffL <= 0u ) || ( NULL == p_ptCtx->puBuff ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check size validity */
+        if( ( p_ptCtx->uFrameCtr > p_ptCtx->uBuffL ) || ( p_ptCtx->uBlockRem > ECU_CUNSTF_MAXBLOCKL ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            /* Only a block that is being copied can have remaining data, and it always have some */
+            if( ( e_eCU_CUNSTFPRV_SM_NEEDDATA == p_ptCtx->eSM ) != ( 0u != p_ptCtx->uBlockRem ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                /* Check status coherence */
+                if( ( e_eCU_CUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM ) && ( p_ptCtx->uFrameCtr <= 0u ) )
+                {
+                    l_eRes = false;
+                }
+                else
+                {
+                    l_eRes = true;
+                }
+            }
+        }
+	}
+
+    return l_eRes;
+}
+
+static e_eCU_CUNSTF_RES eCU_CUNSTF_UnstufCore(t_eCU_CUNSTF_Ctx* const p_ptCtx, const uint8_t* p_puStuffBuf,
+                                              const uint32_t p_uStuffBufL, uint32_t* const p_puConsumedBufL)
+{
+    /* Local variable */
+    e_eCU_CUNSTF_RES l_eRes;
+    uint32_t l_uNExamByte;
+    uint32_t l_uRunL;
+    uint8_t l_uCurByte;
+
+    /* Init counter */
+    l_uNExamByte = 0u;
+
+    /* Init l_eRes */
+    l_eRes = e_eCU_CUNSTF_RES_OK;
+
+    /* Elab all data */
+    while( ( l_uNExamByte < p_uStuffBufL ) && ( e_eCU_CUNSTF_RES_OK == l_eRes ) &&
+           ( e_eCU_CUNSTFPRV_SM_UNSTUFFEND != p_ptCtx->eSM ) &&
+           ( e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL != p_ptCtx->eSM ) )
+    {
+        /* Read current byte */
+        l_uCurByte = p_puStuffBuf[l_uNExamByte];
+
+        /* Decide what to do */
+        switch( p_ptCtx->eSM )
+        {
+            case e_eCU_CUNSTFPRV_SM_NEEDCODE:
+            {
+                if( ECU_CUNSTF_EOF == l_uCurByte )
+                {
+                    /* The zero implicit in the last block is not part of the payload */
+                    p_ptCtx->bPendZero = false;
+
+                    if( p_ptCtx->uFrameCtr <= 0u )
+                    {
+                        /* Found end, but no data received..  */
+                        p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL;
+                    }
+                    else
+                    {
+                        /* Can close the frame, yey */
+                        p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_UNSTUFFEND;
+                    }
+
+                    l_uNExamByte++;
+                }
+                else
+                {
+                    /* A new block is starting, so the zero that ended the previous block is part of the payload */
+                    if( ( true == p_ptCtx->bPendZero ) && ( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL ) )
+                    {
+                        /* No more data avaiable to save that thing */
+                        l_eRes = e_eCU_CUNSTF_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        if( true == p_ptCtx->bPendZero )
+                        {
+                            p_ptCtx->puBuff[p_ptCtx->uFrameCtr] = 0u;
+                            p_ptCtx->uFrameCtr++;
+                        }
+
+                        /* Every block except the full one end with an implicit zero */
+                        p_ptCtx->uBlockRem = ( uint32_t )l_uCurByte - 1u;
+                        p_ptCtx->bPendZero = ( ECU_CUNSTF_FULLBLOCKCODE != l_uCurByte );
+
+                        if( p_ptCtx->uBlockRem > 0u )
+                        {
+                            p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_NEEDDATA;
+                        }
+
+                        l_uNExamByte++;
+                    }
+                }
+                break;
+            }
+
+            case e_eCU_CUNSTFPRV_SM_NEEDDATA:
+            {
+                if( ECU_CUNSTF_EOF == l_uCurByte )
+                {
+                    /* Found end in the middle of a block */
+                    p_ptCtx->uBlockRem = 0u;
+                    p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL;
+                    l_uNExamByte++;
+                }
+                else if( p_ptCtx->uFrameCtr >= p_ptCtx->uBuffL )
+                {
+                    /* No more data avaiable to save that thing */
+                    l_eRes = e_eCU_CUNSTF_RES_OUTOFMEM;
+                }
+                else
+                {
+                    /* Copy all the data of the block checking the avaiable memory only one time */
+                    l_uRunL = p_ptCtx->uBlockRem;
+                    if( l_uRunL > ( p_uStuffBufL - l_uNExamByte ) )
+                    {
+                        l_uRunL = p_uStuffBufL - l_uNExamByte;
+                    }
+
+                    if( l_uRunL > ( p_ptCtx->uBuffL - p_ptCtx->uFrameCtr ) )
+                    {
+                        /* The exceeding data will generate the out of memory error */
+                        l_uRunL = p_ptCtx->uBuffL - p_ptCtx->uFrameCtr;
+                    }
+
+                    /* A zero inside the block will generate the bad frame error */
+                    l_uRunL = eCU_STFPRV_GetNonZeroRunL(&p_puStuffBuf[l_uNExamByte], l_uRunL);
+
+                    (void)memcpy(&p_ptCtx->puBuff[p_ptCtx->uFrameCtr], &p_puStuffBuf[l_uNExamByte], l_uRunL);
+                    p_ptCtx->uFrameCtr += l_uRunL;
+                    p_ptCtx->uBlockRem -= l_uRunL;
+                    l_uNExamByte += l_uRunL;
+
+                    if( p_ptCtx->uBlockRem <= 0u )
+                    {
+                        p_ptCtx->eSM = e_eCU_CUNSTFPRV_SM_NEEDCODE;
+                    }
+                }
+                break;
+            }
+
+            default:
+            {
+                /* Impossible end here, and if so something horrible happened ( memory corruption ) */
+                l_eRes = e_eCU_CUNSTF_RES_CORRUPTCTX;
+                break;
+            }
+        }
+    }
+
+    /* Save the l_eRes */
+    *p_puConsumedBufL = l_uNExamByte;
+
+    if( e_eCU_CUNSTF_RES_OK == l_eRes )
+    {
+        if( e_eCU_CUNSTFPRV_SM_UNSTUFFEND == p_ptCtx->eSM )
+        {
+            l_eRes = e_eCU_CUNSTF_RES_FRAMEENDED;
+        }
+        else if( e_eCU_CUNSTFPRV_SM_UNSTUFFFAIL == p_ptCtx->eSM )
+        {
+           l_eRes = e_eCU_CUNSTF_RES_BADFRAME;
+        }
+        else
+        {
+            /* No error but have other data to unstuff */
+        }
+    }
+
+    return l_eRes;
+}
\ No newline at end of file
@@ -144,21 +144,21 @@ e_eCU_CRCD_RES eCU_CRCD_Digest(t_eCU_CRCD_Ctx* const p_ptCtx, const uint8_t* p_p
     f_eCU_CRCD_CrcCb l_fCb;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_CRCD_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_CRCD_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_CRCD_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_CRCD_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_CRCD_RES_CORRUPTCTX;
             }
@@ -25,6 +25,15 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Max size of a varint, LEB128 store 7 bit of the value in every byte */
+#define ECU_DPK_VAR32MAXL                                                                            ( ( uint32_t ) 5u )
+#define ECU_DPK_VAR64MAXL                                                                           ( ( uint32_t ) 10u )
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS
  **********************************************************************************************************************/
@@ -47,6 +56,14 @@ typedef struct
 	uint32_t uMemPKCtr;
 }t_eCU_DPK_Ctx;
 
+/* Area of a record reserved in the data packer, filled with the inline function of eCU_DPKREC.h */
+typedef struct
+{
+	uint8_t* puCur;
+	uint8_t* puEnd;
+	bool_t bIsLE;
+}t_eCU_DPK_Rec;
+
 
 
 /***********************************************************************************************************************
@@ -133,6 +150,54 @@ e_eCU_DPK_RES eCU_DPK_GetNPushed(t_eCU_DPK_Ctx* const p_ptCtx, uint32_t* const p
  */
 e_eCU_DPK_RES eCU_DPK_PushArray(t_eCU_DPK_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL);
 
+/**
+ * @brief       Push an array of 2 byte element in data packer, converting every element in the selected endianness
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_puData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayU16(t_eCU_DPK_Ctx* const p_ptCtx, const uint16_t* p_puData, const uint32_t p_uDataN);
+
+/**
+ * @brief       Push an array of 4 byte element in data packer, converting every element in the selected endianness
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_puData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t* p_puData, const uint32_t p_uDataN);
+
+/**
+ * @brief       Push an array of 8 byte element in data packer, converting every element in the selected endianness
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_puData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t* p_puData, const uint32_t p_uDataN);
+
 /**
  * @brief       Push one byte in data packer
  *
@@ -189,6 +254,152 @@ e_eCU_DPK_RES eCU_DPK_PushU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uDa
  */
  e_eCU_DPK_RES eCU_DPK_PushU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t p_uData);
 
+/**
+ * @brief       Push a 32 bit value as a LEB128 varint, using from 1 to ECU_DPK_VAR32MAXL byte. Small value
+ *              use less byte.
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_uData         - Data to push in data packer
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push other data
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushVarU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uData);
+
+/**
+ * @brief       Push a 64 bit value as a LEB128 varint, using from 1 to ECU_DPK_VAR64MAXL byte. Small value
+ *              use less byte.
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_uData         - Data to push in data packer
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push other data
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushVarU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t p_uData);
+
+/**
+ * @brief       Push a signed 32 bit value as a zigzag encoded LEB128 varint, so value near to zero use less byte
+ *              even when negative.
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_iData         - Data to push in data packer
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push other data
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushVarS32(t_eCU_DPK_Ctx* const p_ptCtx, const int32_t p_iData);
+
+/**
+ * @brief       Push a signed 64 bit value as a zigzag encoded LEB128 varint, so value near to zero use less byte
+ *              even when negative.
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_iData         - Data to push in data packer
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push other data
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushVarS64(t_eCU_DPK_Ctx* const p_ptCtx, const int64_t p_iData);
+
+/**
+ * @brief       Push an array of 32 bit value, every element as a LEB128 varint
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_puData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array, nothing is pushed
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayVarU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t* p_puData,
+                                      const uint32_t p_uDataN);
+
+/**
+ * @brief       Push an array of 64 bit value, every element as a LEB128 varint
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_puData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array, nothing is pushed
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayVarU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t* p_puData,
+                                      const uint32_t p_uDataN);
+
+/**
+ * @brief       Push an array of 32 bit value, every element as a zigzag encoded LEB128 varint
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_piData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array, nothing is pushed
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayVarS32(t_eCU_DPK_Ctx* const p_ptCtx, const int32_t* p_piData,
+                                      const uint32_t p_uDataN);
+
+/**
+ * @brief       Push an array of 64 bit value, every element as a zigzag encoded LEB128 varint
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_piData        - Pointer to the array of element that we want to push
+ * @param[in]   p_uDataN        - Number of element that we want to push
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole array, nothing is pushed
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_PushArrayVarS64(t_eCU_DPK_Ctx* const p_ptCtx, const int64_t* p_piData,
+                                      const uint32_t p_uDataN);
+
+/**
+ * @brief       Reserve the space of a whole record in the data packer, doing every check only one time. The reserved
+ *              area is counted as pushed data, and must be filled with exactly p_uRecL byte using the unchecked inline
+ *              function of eCU_DPKREC.h, before retriving the packed data.
+ *
+ * @param[in]   p_ptCtx         - Data packer context
+ * @param[in]   p_uRecL         - Size in byte of the record
+ * @param[out]  p_ptRec         - Pointer to a record that will be initialized with the reserved area
+ *
+ * @return      e_eCU_DPK_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DPK_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DPK_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eCU_DPK_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DPK_RES_OUTOFMEM     - Not enought memory to push the whole record
+ *              e_eCU_DPK_RES_OK           - Operation ended correctly
+ */
+e_eCU_DPK_RES eCU_DPK_ReserveRec(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uRecL, t_eCU_DPK_Rec* const p_ptRec);
+
 
 
 #ifdef __cplusplus
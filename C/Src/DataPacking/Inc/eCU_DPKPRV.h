@@ -0,0 +1,440 @@
+/**
+ * @file       eCU_DPKPRV.h
+ *
+ * @brief      Data pack and unpack utils private definition
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_DPKPRV_H
+#define ECU_DPKPRV_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Define ECU_DPK_BYTEWISE in the compiler options in order to pack and unpack every scalar one byte at a time, using
+ * only shift and mask. When not defined every scalar is moved with a single memcpy, that the compiler turn in a
+ * single load or store, and is byte swapped only when the selected endianness is not the host one. */
+/* #define ECU_DPK_BYTEWISE */
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE INLINE FUNCTION
+ **********************************************************************************************************************/
+/**
+ * @brief       Check if the host store data in little endian. The host endianness is taken from the compiler when
+ *              available, otherwise the result is a constant expression. In both case the compiler will remove every
+ *              branch not used by the host.
+ *
+ * @return      true if the host is little endian, false otherwise
+ */
+static inline bool_t eCU_DPKPRV_IsHostLE(void)
+{
+    /* Local variable */
+    bool_t l_bRes;
+
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_LITTLE_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+    l_bRes = true;
+#elif defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+    l_bRes = false;
+#elif defined( __IAR_SYSTEMS_ICC__ ) && defined( __LITTLE_ENDIAN__ )
+    l_bRes = ( 1 == __LITTLE_ENDIAN__ );
+#else
+    uint16_t l_uTest;
+    uint8_t l_uFirst;
+
+    l_uTest = 0x0001u;
+    (void)memcpy(&l_uFirst, &l_uTest, sizeof(l_uFirst));
+    l_bRes = ( 0x01u == l_uFirst );
+#endif
+
+    return l_bRes;
+}
+
+/**
+ * @brief       Reverse the byte order of a 2 byte value, the compiler will use a single byte swap instruction when
+ *              available
+ *
+ * @param[in]   p_uData     - Value to swap
+ *
+ * @return      The swapped value
+ */
+static inline uint16_t eCU_DPKPRV_SwapU16(const uint16_t p_uData)
+{
+    return (uint16_t) ( ( ( (uint16_t) ( p_uData & 0x00FFu ) ) << 8u ) |
+                        ( (uint16_t) ( ( p_uData >> 8u ) & 0x00FFu ) ) );
+}
+
+/**
+ * @brief       Reverse the byte order of a 4 byte value, the compiler will use a single byte swap instruction when
+ *              available
+ *
+ * @param[in]   p_uData     - Value to swap
+ *
+ * @return      The swapped value
+ */
+static inline uint32_t eCU_DPKPRV_SwapU32(const uint32_t p_uData)
+{
+    return (uint32_t) ( ( ( (uint32_t) ( p_uData & 0x000000FFu ) ) << 24u ) |
+                        ( ( (uint32_t) ( ( p_uData >> 8u ) & 0x000000FFu ) ) << 16u ) |
+                        ( ( (uint32_t) ( ( p_uData >> 16u ) & 0x000000FFu ) ) << 8u ) |
+                        ( (uint32_t) ( ( p_uData >> 24u ) & 0x000000FFu ) ) );
+}
+
+/**
+ * @brief       Reverse the byte order of a 8 byte value, the compiler will use a single byte swap instruction when
+ *              available
+ *
+ * @param[in]   p_uData     - Value to swap
+ *
+ * @return      The swapped value
+ */
+static inline uint64_t eCU_DPKPRV_SwapU64(const uint64_t p_uData)
+{
+    return (uint64_t) ( ( ( (uint64_t) ( p_uData & 0x00000000000000FFu ) ) << 56u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 8u ) & 0x00000000000000FFu ) ) << 48u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 16u ) & 0x00000000000000FFu ) ) << 40u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 24u ) & 0x00000000000000FFu ) ) << 32u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 32u ) & 0x00000000000000FFu ) ) << 24u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 40u ) & 0x00000000000000FFu ) ) << 16u ) |
+                        ( ( (uint64_t) ( ( p_uData >> 48u ) & 0x00000000000000FFu ) ) << 8u ) |
+                        ( (uint64_t) ( ( p_uData >> 56u ) & 0x00000000000000FFu ) ) );
+}
+
+/**
+ * @brief       Store a 2 byte value in an area with no alignment, using the selected endianness
+ *
+ * @param[out]  p_puDst     - Destination area of 2 byte
+ * @param[in]   p_uData     - Value to store
+ * @param[in]   p_bIsLE     - true if the value must be stored in Little Endian
+ */
+static inline void eCU_DPKPRV_StoreU16(uint8_t* p_puDst, const uint16_t p_uData, const bool_t p_bIsLE)
+{
+    /* Local variable */
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint16_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * l_uIdx ) ) & 0x00FFu );
+        }
+        else
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * ( 1u - l_uIdx ) ) ) & 0x00FFu );
+        }
+    }
+#else
+    uint16_t l_uData;
+
+    if( p_bIsLE == eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = p_uData;
+    }
+    else
+    {
+        l_uData = eCU_DPKPRV_SwapU16(p_uData);
+    }
+
+    (void)memcpy(p_puDst, &l_uData, sizeof(l_uData));
+#endif
+}
+
+/**
+ * @brief       Load a 2 byte value from an area with no alignment, using the selected endianness
+ *
+ * @param[in]   p_puSrc     - Source area of 2 byte
+ * @param[in]   p_bIsLE     - true if the value is stored in Little Endian
+ *
+ * @return      The loaded value
+ */
+static inline uint16_t eCU_DPKPRV_LoadU16(const uint8_t* p_puSrc, const bool_t p_bIsLE)
+{
+    /* Local variable */
+    uint16_t l_uData;
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    l_uData = 0u;
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint16_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            l_uData |= (uint16_t) ( ( (uint16_t) p_puSrc[l_uIdx] ) << ( 8u * l_uIdx ) );
+        }
+        else
+        {
+            l_uData |= (uint16_t) ( ( (uint16_t) p_puSrc[l_uIdx] ) << ( 8u * ( 1u - l_uIdx ) ) );
+        }
+    }
+#else
+    (void)memcpy(&l_uData, p_puSrc, sizeof(l_uData));
+
+    if( p_bIsLE != eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = eCU_DPKPRV_SwapU16(l_uData);
+    }
+#endif
+
+    return l_uData;
+}
+
+/**
+ * @brief       Store a 4 byte value in an area with no alignment, using the selected endianness
+ *
+ * @param[out]  p_puDst     - Destination area of 4 byte
+ * @param[in]   p_uData     - Value to store
+ * @param[in]   p_bIsLE     - true if the value must be stored in Little Endian
+ */
+static inline void eCU_DPKPRV_StoreU32(uint8_t* p_puDst, const uint32_t p_uData, const bool_t p_bIsLE)
+{
+    /* Local variable */
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint32_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * l_uIdx ) ) & 0x000000FFu );
+        }
+        else
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * ( 3u - l_uIdx ) ) ) & 0x000000FFu );
+        }
+    }
+#else
+    uint32_t l_uData;
+
+    if( p_bIsLE == eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = p_uData;
+    }
+    else
+    {
+        l_uData = eCU_DPKPRV_SwapU32(p_uData);
+    }
+
+    (void)memcpy(p_puDst, &l_uData, sizeof(l_uData));
+#endif
+}
+
+/**
+ * @brief       Load a 4 byte value from an area with no alignment, using the selected endianness
+ *
+ * @param[in]   p_puSrc     - Source area of 4 byte
+ * @param[in]   p_bIsLE     - true if the value is stored in Little Endian
+ *
+ * @return      The loaded value
+ */
+static inline uint32_t eCU_DPKPRV_LoadU32(const uint8_t* p_puSrc, const bool_t p_bIsLE)
+{
+    /* Local variable */
+    uint32_t l_uData;
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    l_uData = 0u;
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint32_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            l_uData |= (uint32_t) ( ( (uint32_t) p_puSrc[l_uIdx] ) << ( 8u * l_uIdx ) );
+        }
+        else
+        {
+            l_uData |= (uint32_t) ( ( (uint32_t) p_puSrc[l_uIdx] ) << ( 8u * ( 3u - l_uIdx ) ) );
+        }
+    }
+#else
+    (void)memcpy(&l_uData, p_puSrc, sizeof(l_uData));
+
+    if( p_bIsLE != eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = eCU_DPKPRV_SwapU32(l_uData);
+    }
+#endif
+
+    return l_uData;
+}
+
+/**
+ * @brief       Store a 8 byte value in an area with no alignment, using the selected endianness
+ *
+ * @param[out]  p_puDst     - Destination area of 8 byte
+ * @param[in]   p_uData     - Value to store
+ * @param[in]   p_bIsLE     - true if the value must be stored in Little Endian
+ */
+static inline void eCU_DPKPRV_StoreU64(uint8_t* p_puDst, const uint64_t p_uData, const bool_t p_bIsLE)
+{
+    /* Local variable */
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint64_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * l_uIdx ) ) & 0x00000000000000FFu );
+        }
+        else
+        {
+            p_puDst[l_uIdx] = (uint8_t) ( ( p_uData >> ( 8u * ( 7u - l_uIdx ) ) ) & 0x00000000000000FFu );
+        }
+    }
+#else
+    uint64_t l_uData;
+
+    if( p_bIsLE == eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = p_uData;
+    }
+    else
+    {
+        l_uData = eCU_DPKPRV_SwapU64(p_uData);
+    }
+
+    (void)memcpy(p_puDst, &l_uData, sizeof(l_uData));
+#endif
+}
+
+/**
+ * @brief       Load a 8 byte value from an area with no alignment, using the selected endianness
+ *
+ * @param[in]   p_puSrc     - Source area of 8 byte
+ * @param[in]   p_bIsLE     - true if the value is stored in Little Endian
+ *
+ * @return      The loaded value
+ */
+static inline uint64_t eCU_DPKPRV_LoadU64(const uint8_t* p_puSrc, const bool_t p_bIsLE)
+{
+    /* Local variable */
+    uint64_t l_uData;
+#ifdef ECU_DPK_BYTEWISE
+    uint32_t l_uIdx;
+
+    l_uData = 0u;
+    for( l_uIdx = 0u; l_uIdx < sizeof(uint64_t); l_uIdx++ )
+    {
+        if( true == p_bIsLE )
+        {
+            l_uData |= (uint64_t) ( ( (uint64_t) p_puSrc[l_uIdx] ) << ( 8u * l_uIdx ) );
+        }
+        else
+        {
+            l_uData |= (uint64_t) ( ( (uint64_t) p_puSrc[l_uIdx] ) << ( 8u * ( 7u - l_uIdx ) ) );
+        }
+    }
+#else
+    (void)memcpy(&l_uData, p_puSrc, sizeof(l_uData));
+
+    if( p_bIsLE != eCU_DPKPRV_IsHostLE() )
+    {
+        l_uData = eCU_DPKPRV_SwapU64(l_uData);
+    }
+#endif
+
+    return l_uData;
+}
+
+/**
+ * @brief       Copy an array of element of p_uElemL byte, converting every element between the host byte order and
+ *              the selected one. When the two order are the same a single memcpy is done, otherwise every element
+ *              is reversed with a simple loop that the compiler can vectorize.
+ *
+ * @param[out]  p_puDst     - Destination area of p_uElemN * p_uElemL byte
+ * @param[in]   p_puSrc     - Source area of p_uElemN * p_uElemL byte
+ * @param[in]   p_uElemN    - Number of element to copy
+ * @param[in]   p_uElemL    - Size in byte of a single element
+ * @param[in]   p_bIsLE     - true if the data packer work in Little Endian
+ */
+static inline void eCU_DPKPRV_CopyElem(uint8_t* p_puDst, const uint8_t* p_puSrc, const uint32_t p_uElemN,
+                                       const uint32_t p_uElemL, const bool_t p_bIsLE)
+{
+    /* Local variable */
+    uint32_t l_uElemIdx;
+    uint32_t l_uByteIdx;
+    uint32_t l_uBase;
+
+    if( p_bIsLE == eCU_DPKPRV_IsHostLE() )
+    {
+        /* Same byte order, raw copy */
+        (void)memcpy(p_puDst, p_puSrc, ( p_uElemN * p_uElemL ) );
+    }
+    else
+    {
+        /* Reverse every element */
+        for( l_uElemIdx = 0u; l_uElemIdx < p_uElemN; l_uElemIdx++ )
+        {
+            l_uBase = l_uElemIdx * p_uElemL;
+
+            for( l_uByteIdx = 0u; l_uByteIdx < p_uElemL; l_uByteIdx++ )
+            {
+                p_puDst[l_uBase + l_uByteIdx] = p_puSrc[l_uBase + ( p_uElemL - 1u - l_uByteIdx )];
+            }
+        }
+    }
+}
+
+/**
+ * @brief       Zigzag encoding of a signed value, so small negative value are encoded as small unsigned value too
+ *              ( 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3 ... ). A sign extended 32 bit value give the same result of the
+ *              32 bit zigzag encoding.
+ *
+ * @param[in]   p_iData     - Signed value to encode
+ *
+ * @return      The encoded value
+ */
+static inline uint64_t eCU_DPKPRV_ZigZagEnc(const int64_t p_iData)
+{
+    /* Local variable */
+    uint64_t l_uData;
+
+    l_uData = ( (uint64_t) p_iData ) << 1u;
+
+    if( p_iData < 0 )
+    {
+        l_uData = ~l_uData;
+    }
+
+    return l_uData;
+}
+
+/**
+ * @brief       Zigzag decoding of a value encoded with eCU_DPKPRV_ZigZagEnc
+ *
+ * @param[in]   p_uData     - Encoded value
+ *
+ * @return      The signed value
+ */
+static inline int64_t eCU_DPKPRV_ZigZagDec(const uint64_t p_uData)
+{
+    return (int64_t) ( ( p_uData >> 1u ) ^ ( 0u - ( p_uData & 1u ) ) );
+}
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_DPKPRV_H */
\ No newline at end of file
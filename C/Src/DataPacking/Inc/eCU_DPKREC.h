@@ -0,0 +1,112 @@
+/**
+ * @file       eCU_DPKREC.h
+ *
+ * @brief      Data pack record utils, unchecked inline push of a reserved record
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_DPKREC_H
+#define ECU_DPKREC_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_DPK.h"
+#include "eCU_DPKPRV.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL INLINE FUNCTION
+ **********************************************************************************************************************/
+/**
+ * @brief       Push one byte in a reserved record, without any check
+ *
+ * @param[in]   p_ptRec         - Record reserved with eCU_DPK_ReserveRec
+ * @param[in]   p_uData         - Data to push in the record
+ */
+static inline void eCU_DPKREC_PushU8(t_eCU_DPK_Rec* const p_ptRec, const uint8_t p_uData)
+{
+    p_ptRec->puCur[0u] = p_uData;
+    p_ptRec->puCur = &p_ptRec->puCur[1u];
+}
+
+/**
+ * @brief       Push 2 byte in a reserved record, without any check
+ *
+ * @param[in]   p_ptRec         - Record reserved with eCU_DPK_ReserveRec
+ * @param[in]   p_uData         - Data to push in the record
+ */
+static inline void eCU_DPKREC_PushU16(t_eCU_DPK_Rec* const p_ptRec, const uint16_t p_uData)
+{
+    /* Local variable, a local cursor lets the compiler merge consecutive stores */
+    uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    eCU_DPKPRV_StoreU16(l_puCur, p_uData, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[2u];
+}
+
+/**
+ * @brief       Push 4 byte in a reserved record, without any check
+ *
+ * @param[in]   p_ptRec         - Record reserved with eCU_DPK_ReserveRec
+ * @param[in]   p_uData         - Data to push in the record
+ */
+static inline void eCU_DPKREC_PushU32(t_eCU_DPK_Rec* const p_ptRec, const uint32_t p_uData)
+{
+    /* Local variable, a local cursor lets the compiler merge consecutive stores */
+    uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    eCU_DPKPRV_StoreU32(l_puCur, p_uData, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[4u];
+}
+
+/**
+ * @brief       Push 8 byte in a reserved record, without any check
+ *
+ * @param[in]   p_ptRec         - Record reserved with eCU_DPK_ReserveRec
+ * @param[in]   p_uData         - Data to push in the record
+ */
+static inline void eCU_DPKREC_PushU64(t_eCU_DPK_Rec* const p_ptRec, const uint64_t p_uData)
+{
+    /* Local variable, a local cursor lets the compiler merge consecutive stores */
+    uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    eCU_DPKPRV_StoreU64(l_puCur, p_uData, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[8u];
+}
+
+/**
+ * @brief       Retrive how many byte of the record must still be pushed
+ *
+ * @param[in]   p_ptRec         - Record reserved with eCU_DPK_ReserveRec
+ *
+ * @return      Number of byte not pushed yet
+ */
+static inline uint32_t eCU_DPKREC_GetRemL(const t_eCU_DPK_Rec* p_ptRec)
+{
+    return (uint32_t) ( p_ptRec->puEnd - p_ptRec->puCur );
+}
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_DPKREC_H */
\ No newline at end of file
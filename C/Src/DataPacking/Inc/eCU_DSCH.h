@@ -0,0 +1,144 @@
+/**
+ * @file       eCU_DSCH.h
+ *
+ * @brief      Data schema utils. Pack and unpack a whole C struct in a single call, using a table that describe the
+ *             offset, the element size and the number of element of every field. The fields are placed in the packed
+ *             data one after the other, without any padding, in the endianness of the data packer or unpacker.
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_DSCH_H
+#define ECU_DSCH_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+#include "eCU_DPK.h"
+#include "eCU_DUNPK.h"
+#include <stddef.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Describe a scalar field of a struct, the element size is the size of the member */
+#define ECU_DSCH_FIELD( type, member )                                                                                \
+    { ( uint32_t ) offsetof( type, member ), ( uint32_t ) sizeof( ( ( type* ) 0 )->member ), 1u }
+
+/* Describe an array field of a struct, the element size is the size of the first element of the member */
+#define ECU_DSCH_ARRAY( type, member )                                                                                \
+    { ( uint32_t ) offsetof( type, member ), ( uint32_t ) sizeof( ( ( type* ) 0 )->member[0] ),                      \
+      ( uint32_t ) ( sizeof( ( ( type* ) 0 )->member ) / sizeof( ( ( type* ) 0 )->member[0] ) ) }
+
+/* Describe a whole struct, given a static array of field */
+#define ECU_DSCH_SCHEMA( type, fieldArray )                                                                           \
+    { ( fieldArray ), ( uint32_t ) ( sizeof( fieldArray ) / sizeof( ( fieldArray )[0] ) ), ( uint32_t ) sizeof( type ) }
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_DSCH_RES_OK = 0,
+    e_eCU_DSCH_RES_BADPARAM,
+    e_eCU_DSCH_RES_BADPOINTER,
+	e_eCU_DSCH_RES_CORRUPTCTX,
+    e_eCU_DSCH_RES_OUTOFMEM,
+    e_eCU_DSCH_RES_NODATA,
+    e_eCU_DSCH_RES_NOINITLIB,
+    e_eCU_DSCH_RES_NOINITFRAME,
+}e_eCU_DSCH_RES;
+
+/* A field of the struct, made by uCount element of uElemL byte ( 1, 2, 4 or 8 ) starting at uOff */
+typedef struct
+{
+	uint32_t uOff;
+	uint32_t uElemL;
+	uint32_t uCount;
+}t_eCU_DSCH_Field;
+
+/* Layout of a struct of uStructL byte, fields are packed in the same order of the table */
+typedef struct
+{
+	const t_eCU_DSCH_Field* ptField;
+	uint32_t uFieldN;
+	uint32_t uStructL;
+}t_eCU_DSCH_Schema;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Check a schema and retrive the size of the packed data of a struct described by the schema
+ *
+ * @param[in]   p_ptSch       - Schema of the struct
+ * @param[out]  p_puPackL     - Pointer to a uint32_t variable where the size of the packed data will be placed
+ *
+ * @return      e_eCU_DSCH_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DSCH_RES_BADPARAM     - The schema is not valid, an element size is not 1, 2, 4 or 8, a field
+ *                                            is empty or is outside the struct
+ *              e_eCU_DSCH_RES_OK           - Operation ended correctly
+ */
+e_eCU_DSCH_RES eCU_DSCH_GetPackL(const t_eCU_DSCH_Schema* p_ptSch, uint32_t* const p_puPackL);
+
+/**
+ * @brief       Push a whole struct in the data packer. Space for every field is checked only one time, and fields
+ *              that are contiguous in the struct and don't need a byte swap are copied together.
+ *
+ * @param[in]   p_ptCtx       - Data packer context
+ * @param[in]   p_ptSch       - Schema of the struct
+ * @param[in]   p_pvStruct    - Pointer to the struct that we want to push
+ *
+ * @return      e_eCU_DSCH_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DSCH_RES_NOINITLIB    - Need to init the data packer before taking some action
+ *		        e_eCU_DSCH_RES_BADPARAM     - The schema is not valid
+ *		        e_eCU_DSCH_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DSCH_RES_OUTOFMEM     - Not enought memory to push the whole struct, nothing is pushed
+ *              e_eCU_DSCH_RES_OK           - Operation ended correctly
+ */
+e_eCU_DSCH_RES eCU_DSCH_Pack(t_eCU_DPK_Ctx* const p_ptCtx, const t_eCU_DSCH_Schema* p_ptSch, const void* p_pvStruct);
+
+/**
+ * @brief       Pop a whole struct from the data unpacker. Data for every field is checked only one time, and fields
+ *              that are contiguous in the struct and don't need a byte swap are copied together. Padding of the
+ *              struct is not modified.
+ *
+ * @param[in]   p_ptCtx       - Data Unpacker context
+ * @param[in]   p_ptSch       - Schema of the struct
+ * @param[out]  p_pvStruct    - Pointer to the struct that will be filled with the popped data
+ *
+ * @return      e_eCU_DSCH_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_DSCH_RES_NOINITLIB    - Need to init the data unpacker before taking some action
+ *		        e_eCU_DSCH_RES_BADPARAM     - The schema is not valid
+ *		        e_eCU_DSCH_RES_NOINITFRAME  - Need to start a frame before popping data
+ *		        e_eCU_DSCH_RES_CORRUPTCTX   - In case of a corrupted context
+ *              e_eCU_DSCH_RES_NODATA       - Not so much data to pop the whole struct, nothing is popped
+ *              e_eCU_DSCH_RES_OK           - Operation ended correctly
+ */
+e_eCU_DSCH_RES eCU_DSCH_Unpack(t_eCU_DUNPK_Ctx* const p_ptCtx, const t_eCU_DSCH_Schema* p_ptSch, void* p_pvStruct);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_DSCH_H */
\ No newline at end of file
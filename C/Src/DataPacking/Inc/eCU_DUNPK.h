@@ -25,6 +25,15 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Max size of a varint, LEB128 store 7 bit of the value in every byte */
+#define ECU_DUNPK_VAR32MAXL                                                                          ( ( uint32_t ) 5u )
+#define ECU_DUNPK_VAR64MAXL                                                                         ( ( uint32_t ) 10u )
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS
  **********************************************************************************************************************/
@@ -37,6 +46,7 @@ typedef enum
     e_eCU_DUNPK_RES_NODATA,
     e_eCU_DUNPK_RES_NOINITLIB,
     e_eCU_DUNPK_RES_NOINITFRAME,
+    e_eCU_DUNPK_RES_BADDATA,
 }e_eCU_DUNPK_RES;
 
 typedef struct
@@ -49,6 +59,14 @@ typedef struct
 	uint32_t uMemUPKCtr;
 }t_eCU_DUNPK_Ctx;
 
+/* Area of a record taken from the data unpacker, read with the inline function of eCU_DUNPKREC.h */
+typedef struct
+{
+	const uint8_t* puCur;
+	const uint8_t* puEnd;
+	bool_t bIsLE;
+}t_eCU_DUNPK_Rec;
+
 
 
 /***********************************************************************************************************************
@@ -157,6 +175,57 @@ e_eCU_DUNPK_RES eCU_DUNPK_GetRemToPop(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t*
  */
 e_eCU_DUNPK_RES eCU_DUNPK_PopArray(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_puData, uint32_t const p_uToGetL);
 
+/**
+ * @brief       Pop an array of 2 byte element, converting every element from the selected endianness
+ *
+ * @param[in]   p_ptCtx     - Data Unpacker context
+ * @param[out]  p_puData    - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN   - The number of element that need to be copied in p_puData
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - Not so much data to pop
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU16(t_eCU_DUNPK_Ctx* const p_ptCtx, uint16_t* p_puData, const uint32_t p_uToGetN);
+
+/**
+ * @brief       Pop an array of 4 byte element, converting every element from the selected endianness
+ *
+ * @param[in]   p_ptCtx     - Data Unpacker context
+ * @param[out]  p_puData    - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN   - The number of element that need to be copied in p_puData
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - Not so much data to pop
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData, const uint32_t p_uToGetN);
+
+/**
+ * @brief       Pop an array of 8 byte element, converting every element from the selected endianness
+ *
+ * @param[in]   p_ptCtx     - Data Unpacker context
+ * @param[out]  p_puData    - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN   - The number of element that need to be copied in p_puData
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - Not so much data to pop
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData, const uint32_t p_uToGetN);
+
 /**
  * @brief       Pop one byte from data passed to session
  *
@@ -217,6 +286,165 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puD
  */
 e_eCU_DUNPK_RES eCU_DUNPK_PopU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData);
 
+/**
+ * @brief       Pop a 32 bit value encoded as a LEB128 varint of max ECU_DUNPK_VAR32MAXL byte
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_puData       - Pointer to a variable that will contain the popped data
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData);
+
+/**
+ * @brief       Pop a 64 bit value encoded as a LEB128 varint of max ECU_DUNPK_VAR64MAXL byte
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_puData       - Pointer to a variable that will contain the popped data
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData);
+
+/**
+ * @brief       Pop a signed 32 bit value encoded as a zigzag LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_piData       - Pointer to a variable that will contain the popped data
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarS32(t_eCU_DUNPK_Ctx* const p_ptCtx, int32_t* p_piData);
+
+/**
+ * @brief       Pop a signed 64 bit value encoded as a zigzag LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_piData       - Pointer to a variable that will contain the popped data
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarS64(t_eCU_DUNPK_Ctx* const p_ptCtx, int64_t* p_piData);
+
+/**
+ * @brief       Pop an array of 32 bit value, every element encoded as a LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_puData       - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN      - The number of element that need to be copied
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint, nothing is popped
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type, nothing is popped
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData,
+                                         const uint32_t p_uToGetN);
+
+/**
+ * @brief       Pop an array of 64 bit value, every element encoded as a LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_puData       - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN      - The number of element that need to be copied
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint, nothing is popped
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type, nothing is popped
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData,
+                                         const uint32_t p_uToGetN);
+
+/**
+ * @brief       Pop an array of 32 bit value, every element encoded as a zigzag LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_piData       - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN      - The number of element that need to be copied
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint, nothing is popped
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type, nothing is popped
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarS32(t_eCU_DUNPK_Ctx* const p_ptCtx, int32_t* p_piData,
+                                         const uint32_t p_uToGetN);
+
+/**
+ * @brief       Pop an array of 64 bit value, every element encoded as a zigzag LEB128 varint
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[out]  p_piData       - Pointer to the array where popped element will be copied
+ * @param[in]   p_uToGetN      - The number of element that need to be copied
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before popping data
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - The frame end in the middle of a varint, nothing is popped
+ *              e_eCU_DUNPK_RES_BADDATA     - Varint longer than the max size or bigger than the type, nothing is popped
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarS64(t_eCU_DUNPK_Ctx* const p_ptCtx, int64_t* p_piData,
+                                         const uint32_t p_uToGetN);
+
+/**
+ * @brief       Take the data of a whole record from the data unpacker, doing every check only one time. The record
+ *              data is counted as popped, and can be read with the unchecked inline function of eCU_DUNPKREC.h
+ *
+ * @param[in]   p_ptCtx        - Data Unpacker context
+ * @param[in]   p_uRecL        - Size in byte of the record
+ * @param[out]  p_ptRec        - Pointer to a record that will be initialized with the record data
+ *
+ * @return      e_eCU_DUNPK_RES_BADPOINTER  - In case of bad pointer passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITLIB   - Need to init the data unpacker before taking some action
+ *		        e_eCU_DUNPK_RES_BADPARAM    - In case of an invalid parameter passed to the function
+ *		        e_eCU_DUNPK_RES_NOINITFRAME - Need to start a frame before taking a record
+ *		        e_eCU_DUNPK_RES_CORRUPTCTX  - In case of a corrupted context
+ *              e_eCU_DUNPK_RES_NODATA      - Not so much data to pop
+ *              e_eCU_DUNPK_RES_OK          - Operation ended correctly
+ */
+e_eCU_DUNPK_RES eCU_DUNPK_GetRec(t_eCU_DUNPK_Ctx* const p_ptCtx, const uint32_t p_uRecL,
+                                 t_eCU_DUNPK_Rec* const p_ptRec);
+
 
 
 #ifdef __cplusplus
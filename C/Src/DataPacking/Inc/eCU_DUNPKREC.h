@@ -0,0 +1,130 @@
+/**
+ * @file       eCU_DUNPKREC.h
+ *
+ * @brief      Data unpack record utils, unchecked inline pop of a taken record
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_DUNPKREC_H
+#define ECU_DUNPKREC_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_DUNPK.h"
+#include "eCU_DPKPRV.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL INLINE FUNCTION
+ **********************************************************************************************************************/
+/**
+ * @brief       Pop one byte from a taken record, without any check
+ *
+ * @param[in]   p_ptRec        - Record taken with eCU_DUNPK_GetRec
+ *
+ * @return      The popped data
+ */
+static inline uint8_t eCU_DUNPKREC_PopU8(t_eCU_DUNPK_Rec* const p_ptRec)
+{
+    /* Local variable */
+    uint8_t l_uData;
+
+    l_uData = p_ptRec->puCur[0u];
+    p_ptRec->puCur = &p_ptRec->puCur[1u];
+
+    return l_uData;
+}
+
+/**
+ * @brief       Pop 2 byte from a taken record, without any check
+ *
+ * @param[in]   p_ptRec        - Record taken with eCU_DUNPK_GetRec
+ *
+ * @return      The popped data
+ */
+static inline uint16_t eCU_DUNPKREC_PopU16(t_eCU_DUNPK_Rec* const p_ptRec)
+{
+    /* Local variable */
+    uint16_t l_uData;
+    const uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    l_uData = eCU_DPKPRV_LoadU16(l_puCur, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[2u];
+
+    return l_uData;
+}
+
+/**
+ * @brief       Pop 4 byte from a taken record, without any check
+ *
+ * @param[in]   p_ptRec        - Record taken with eCU_DUNPK_GetRec
+ *
+ * @return      The popped data
+ */
+static inline uint32_t eCU_DUNPKREC_PopU32(t_eCU_DUNPK_Rec* const p_ptRec)
+{
+    /* Local variable */
+    uint32_t l_uData;
+    const uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    l_uData = eCU_DPKPRV_LoadU32(l_puCur, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[4u];
+
+    return l_uData;
+}
+
+/**
+ * @brief       Pop 8 byte from a taken record, without any check
+ *
+ * @param[in]   p_ptRec        - Record taken with eCU_DUNPK_GetRec
+ *
+ * @return      The popped data
+ */
+static inline uint64_t eCU_DUNPKREC_PopU64(t_eCU_DUNPK_Rec* const p_ptRec)
+{
+    /* Local variable */
+    uint64_t l_uData;
+    const uint8_t* l_puCur;
+
+    l_puCur = p_ptRec->puCur;
+    l_uData = eCU_DPKPRV_LoadU64(l_puCur, p_ptRec->bIsLE);
+    p_ptRec->puCur = &l_puCur[8u];
+
+    return l_uData;
+}
+
+/**
+ * @brief       Retrive how many byte of the record can still be popped
+ *
+ * @param[in]   p_ptRec        - Record taken with eCU_DUNPK_GetRec
+ *
+ * @return      Number of byte not popped yet
+ */
+static inline uint32_t eCU_DUNPKREC_GetRemL(const t_eCU_DUNPK_Rec* p_ptRec)
+{
+    return (uint32_t) ( p_ptRec->puEnd - p_ptRec->puCur );
+}
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_DUNPKREC_H */
\ No newline at end of file
@@ -11,6 +11,7 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eCU_DPK.h"
+#include "eCU_DPKPRV.h"
 
 
 
@@ -18,6 +19,12 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eCU_DPK_IsStatusStillCoherent(const t_eCU_DPK_Ctx* p_ptCtx);
+static e_eCU_DPK_RES eCU_DPK_PushElem(t_eCU_DPK_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataN,
+                                      const uint32_t p_uElemL);
+static e_eCU_DPK_RES eCU_DPK_PushVarElem(t_eCU_DPK_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataN,
+                                         const uint32_t p_uElemL, const bool_t p_bIsSigned);
+static uint64_t eCU_DPK_GetVarElem(const uint8_t* p_puData, const uint32_t p_uElemL, const bool_t p_bIsSigned);
+static uint32_t eCU_DPK_EncodeVar(uint8_t* p_puDst, const uint64_t p_uData);
 
 
 
@@ -189,21 +196,21 @@ e_eCU_DPK_RES eCU_DPK_PushArray(t_eCU_DPK_Ctx* const p_ptCtx, uint8_t* p_puData,
 	e_eCU_DPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
             }
@@ -239,27 +246,42 @@ e_eCU_DPK_RES eCU_DPK_PushArray(t_eCU_DPK_Ctx* const p_ptCtx, uint8_t* p_puData,
 	return l_eRes;
 }
 
+e_eCU_DPK_RES eCU_DPK_PushArrayU16(t_eCU_DPK_Ctx* const p_ptCtx, const uint16_t* p_puData, const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushElem(p_ptCtx, (const uint8_t*) p_puData, p_uDataN, sizeof(uint16_t));
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t* p_puData, const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushElem(p_ptCtx, (const uint8_t*) p_puData, p_uDataN, sizeof(uint32_t));
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t* p_puData, const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushElem(p_ptCtx, (const uint8_t*) p_puData, p_uDataN, sizeof(uint64_t));
+}
+
 e_eCU_DPK_RES eCU_DPK_PushU8(t_eCU_DPK_Ctx* const p_ptCtx, const uint8_t p_uData)
 {
 	/* Local variable */
 	e_eCU_DPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ECU_HOTCHK( NULL == p_ptCtx ) )
 	{
 		l_eRes = e_eCU_DPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
             }
@@ -294,21 +316,21 @@ e_eCU_DPK_RES eCU_DPK_PushU16(t_eCU_DPK_Ctx* const p_ptCtx, const uint16_t p_uDa
 	e_eCU_DPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ECU_HOTCHK( NULL == p_ptCtx ) )
 	{
 		l_eRes = e_eCU_DPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
             }
@@ -322,22 +344,11 @@ e_eCU_DPK_RES eCU_DPK_PushU16(t_eCU_DPK_Ctx* const p_ptCtx, const uint16_t p_uDa
                 }
                 else
                 {
-                    if( true == p_ptCtx->bIsLE)
-                    {
-                        /* Copy data Little endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x00FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x00FFu );
-                        p_ptCtx->uMemPKCtr++;
-                    }
-                    else
-                    {
-                        /* Copy data big endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x00FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x00FFu );
-                        p_ptCtx->uMemPKCtr++;
-                    }
+                    /* Copy data in the selected endianness */
+                    eCU_DPKPRV_StoreU16(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], p_uData, p_ptCtx->bIsLE);
+
+                    /* Update index */
+                    p_ptCtx->uMemPKCtr += sizeof(uint16_t);
 
                     l_eRes = e_eCU_DPK_RES_OK;
                 }
@@ -354,21 +365,21 @@ e_eCU_DPK_RES eCU_DPK_PushU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uDa
 	e_eCU_DPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ECU_HOTCHK( NULL == p_ptCtx ) )
 	{
 		l_eRes = e_eCU_DPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
             }
@@ -382,30 +393,11 @@ e_eCU_DPK_RES eCU_DPK_PushU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uDa
                 }
                 else
                 {
-                    if( true == p_ptCtx->bIsLE)
-                    {
-                        /* Copy data Little endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 16u ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 24u ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                    }
-                    else
-                    {
-                        /* Copy data big endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 24u ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 16u ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                    }
+                    /* Copy data in the selected endianness */
+                    eCU_DPKPRV_StoreU32(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], p_uData, p_ptCtx->bIsLE);
+
+                    /* Update index */
+                    p_ptCtx->uMemPKCtr += sizeof(uint32_t);
 
                     l_eRes = e_eCU_DPK_RES_OK;
                 }
@@ -422,21 +414,21 @@ e_eCU_DPK_RES eCU_DPK_PushU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t p_uDa
 	e_eCU_DPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ECU_HOTCHK( NULL == p_ptCtx ) )
 	{
 		l_eRes = e_eCU_DPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
             }
@@ -450,50 +442,115 @@ e_eCU_DPK_RES eCU_DPK_PushU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t p_uDa
                 }
                 else
                 {
-                    if( true == p_ptCtx->bIsLE)
+                    /* Copy data in the selected endianness */
+                    eCU_DPKPRV_StoreU64(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], p_uData, p_ptCtx->bIsLE);
+
+                    /* Update index */
+                    p_ptCtx->uMemPKCtr += sizeof(uint64_t);
+
+                    l_eRes = e_eCU_DPK_RES_OK;
+                }
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_DPK_RES eCU_DPK_PushVarU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uData)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) &p_uData, 1u, sizeof(uint32_t), false);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushVarU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t p_uData)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) &p_uData, 1u, sizeof(uint64_t), false);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushVarS32(t_eCU_DPK_Ctx* const p_ptCtx, const int32_t p_iData)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) &p_iData, 1u, sizeof(int32_t), true);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushVarS64(t_eCU_DPK_Ctx* const p_ptCtx, const int64_t p_iData)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) &p_iData, 1u, sizeof(int64_t), true);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayVarU32(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t* p_puData,
+                                      const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) p_puData, p_uDataN, sizeof(uint32_t), false);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayVarU64(t_eCU_DPK_Ctx* const p_ptCtx, const uint64_t* p_puData,
+                                      const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) p_puData, p_uDataN, sizeof(uint64_t), false);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayVarS32(t_eCU_DPK_Ctx* const p_ptCtx, const int32_t* p_piData,
+                                      const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) p_piData, p_uDataN, sizeof(int32_t), true);
+}
+
+e_eCU_DPK_RES eCU_DPK_PushArrayVarS64(t_eCU_DPK_Ctx* const p_ptCtx, const int64_t* p_piData,
+                                      const uint32_t p_uDataN)
+{
+    return eCU_DPK_PushVarElem(p_ptCtx, (const uint8_t*) p_piData, p_uDataN, sizeof(int64_t), true);
+}
+
+e_eCU_DPK_RES eCU_DPK_ReserveRec(t_eCU_DPK_Ctx* const p_ptCtx, const uint32_t p_uRecL, t_eCU_DPK_Rec* const p_ptRec)
+{
+	/* Local variable */
+	e_eCU_DPK_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptRec ) )
+	{
+		l_eRes = e_eCU_DPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_DPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uRecL <= 0u )
+                {
+                    l_eRes = e_eCU_DPK_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Check if we have memory for the whole record */
+                    if( p_uRecL > ( p_ptCtx->uMemPKL - p_ptCtx->uMemPKCtr ) )
                     {
-                        /* Copy data Little endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 16u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 24u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 32u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 40u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 48u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 56u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
+                        l_eRes = e_eCU_DPK_RES_OUTOFMEM;
                     }
                     else
                     {
-                        /* Copy data big endian */
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 56u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 48u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 40u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 32u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 24u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 16u ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData >> 8u  ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                        p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr] = (uint8_t) ( ( p_uData        ) & 0x00000000000000FFu );
-                        p_ptCtx->uMemPKCtr++;
-                    }
+                        /* Give the area to the record and count it as pushed */
+                        p_ptRec->puCur = &p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr];
+                        p_ptRec->puEnd = &p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr + p_uRecL];
+                        p_ptRec->bIsLE = p_ptCtx->bIsLE;
+                        p_ptCtx->uMemPKCtr += p_uRecL;
 
-                    l_eRes = e_eCU_DPK_RES_OK;
+                        l_eRes = e_eCU_DPK_RES_OK;
+                    }
                 }
-            }
+			}
 		}
     }
 
@@ -528,4 +585,207 @@ static bool_t eCU_DPK_IsStatusStillCoherent(const t_eCU_DPK_Ctx* p_ptCtx)
 	}
 
     return l_eRes;
+}
+
+static e_eCU_DPK_RES eCU_DPK_PushElem(t_eCU_DPK_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataN,
+                                      const uint32_t p_uElemL)
+{
+	/* Local variable */
+	e_eCU_DPK_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
+	{
+		l_eRes = e_eCU_DPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
+		{
+			l_eRes = e_eCU_DPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
+            {
+                l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uDataN <= 0u )
+                {
+                    l_eRes = e_eCU_DPK_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Check if we have memory for this, without overflowing */
+                    if( p_uDataN > ( ( p_ptCtx->uMemPKL - p_ptCtx->uMemPKCtr ) / p_uElemL ) )
+                    {
+                        l_eRes = e_eCU_DPK_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        /* Copy data converting the endianness */
+                        eCU_DPKPRV_CopyElem(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], p_puData, p_uDataN, p_uElemL,
+                                            p_ptCtx->bIsLE);
+
+                        /* Update index */
+                        p_ptCtx->uMemPKCtr += ( p_uDataN * p_uElemL );
+
+                        l_eRes = e_eCU_DPK_RES_OK;
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+static e_eCU_DPK_RES eCU_DPK_PushVarElem(t_eCU_DPK_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataN,
+                                         const uint32_t p_uElemL, const bool_t p_bIsSigned)
+{
+	/* Local variable */
+	e_eCU_DPK_RES l_eRes;
+    uint8_t l_auVar[ECU_DPK_VAR64MAXL];
+    uint32_t l_uStartCtr;
+    uint32_t l_uElemIdx;
+    uint32_t l_uVarL;
+    uint64_t l_uData;
+
+	/* Check pointer validity */
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
+	{
+		l_eRes = e_eCU_DPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
+		{
+			l_eRes = e_eCU_DPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ECU_HOTCHK( false == eCU_DPK_IsStatusStillCoherent(p_ptCtx) ) )
+            {
+                l_eRes = e_eCU_DPK_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uDataN <= 0u )
+                {
+                    l_eRes = e_eCU_DPK_RES_BADPARAM;
+                }
+                else
+                {
+                    l_uStartCtr = p_ptCtx->uMemPKCtr;
+                    l_uElemIdx = 0u;
+                    l_eRes = e_eCU_DPK_RES_OK;
+
+                    while( ( l_uElemIdx < p_uDataN ) && ( e_eCU_DPK_RES_OK == l_eRes ) )
+                    {
+                        l_uData = eCU_DPK_GetVarElem(&p_puData[l_uElemIdx * p_uElemL], p_uElemL, p_bIsSigned);
+
+                        if( ( p_ptCtx->uMemPKL - p_ptCtx->uMemPKCtr ) >= ECU_DPK_VAR64MAXL )
+                        {
+                            /* There is space for the longest varint, encode directly in the packer */
+                            l_uVarL = eCU_DPK_EncodeVar(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], l_uData);
+                            p_ptCtx->uMemPKCtr += l_uVarL;
+                        }
+                        else
+                        {
+                            /* Near the end of the packer, check the real size */
+                            l_uVarL = eCU_DPK_EncodeVar(l_auVar, l_uData);
+
+                            if( l_uVarL > ( p_ptCtx->uMemPKL - p_ptCtx->uMemPKCtr ) )
+                            {
+                                l_eRes = e_eCU_DPK_RES_OUTOFMEM;
+                            }
+                            else
+                            {
+                                (void)memcpy(&p_ptCtx->puMemPK[p_ptCtx->uMemPKCtr], l_auVar, l_uVarL);
+                                p_ptCtx->uMemPKCtr += l_uVarL;
+                            }
+                        }
+
+                        l_uElemIdx++;
+                    }
+
+                    if( e_eCU_DPK_RES_OK != l_eRes )
+                    {
+                        /* Nothing is pushed */
+                        p_ptCtx->uMemPKCtr = l_uStartCtr;
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+static uint64_t eCU_DPK_GetVarElem(const uint8_t* p_puData, const uint32_t p_uElemL, const bool_t p_bIsSigned)
+{
+	/* Local variable */
+    uint64_t l_uData;
+    uint32_t l_uData32;
+    int64_t l_iData64;
+    int32_t l_iData32;
+
+    if( sizeof(uint32_t) == p_uElemL )
+    {
+        if( true == p_bIsSigned )
+        {
+            (void)memcpy(&l_iData32, p_puData, sizeof(l_iData32));
+            l_uData = eCU_DPKPRV_ZigZagEnc( (int64_t) l_iData32 );
+        }
+        else
+        {
+            (void)memcpy(&l_uData32, p_puData, sizeof(l_uData32));
+            l_uData = (uint64_t) l_uData32;
+        }
+    }
+    else
+    {
+        if( true == p_bIsSigned )
+        {
+            (void)memcpy(&l_iData64, p_puData, sizeof(l_iData64));
+            l_uData = eCU_DPKPRV_ZigZagEnc(l_iData64);
+        }
+        else
+        {
+            (void)memcpy(&l_uData, p_puData, sizeof(l_uData));
+        }
+    }
+
+    return l_uData;
+}
+
+static uint32_t eCU_DPK_EncodeVar(uint8_t* p_puDst, const uint64_t p_uData)
+{
+	/* Local variable */
+    uint64_t l_uData;
+    uint32_t l_uVarL;
+
+    l_uData = p_uData;
+    l_uVarL = 0u;
+
+    /* 7 bit for every byte, starting from the least significant, the MSB tell that other byte follow */
+    while( l_uData > 0x7Fu )
+    {
+        p_puDst[l_uVarL] = (uint8_t) ( ( l_uData & 0x7Fu ) | 0x80u );
+        l_uData >>= 7u;
+        l_uVarL++;
+    }
+
+    p_puDst[l_uVarL] = (uint8_t) l_uData;
+    l_uVarL++;
+
+    return l_uVarL;
 }
\ No newline at end of file
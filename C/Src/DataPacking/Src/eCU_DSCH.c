@@ -0,0 +1,384 @@
+/**
+ * @file       eCU_DSCH.c
+ *
+ * @brief      Data schema utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_DSCH.h"
+#include "eCU_DPKPRV.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static e_eCU_DSCH_RES eCU_DSCH_CheckSchema(const t_eCU_DSCH_Schema* p_ptSch, uint32_t* const p_puPackL);
+static uint32_t eCU_DSCH_GetRunL(const t_eCU_DSCH_Schema* p_ptSch, const uint32_t p_uFieldIdx, const bool_t p_bSameOrd,
+                                 uint32_t* const p_puRunN);
+static e_eCU_DSCH_RES eCU_DSCH_ConvertDpkRes(const e_eCU_DPK_RES p_eDpkRes);
+static e_eCU_DSCH_RES eCU_DSCH_ConvertDunpkRes(const e_eCU_DUNPK_RES p_eDunpkRes);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_DSCH_RES eCU_DSCH_GetPackL(const t_eCU_DSCH_Schema* p_ptSch, uint32_t* const p_puPackL)
+{
+	/* Local variable */
+	e_eCU_DSCH_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptSch ) || ( NULL == p_puPackL ) )
+	{
+		l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eCU_DSCH_CheckSchema(p_ptSch, p_puPackL);
+	}
+
+	return l_eRes;
+}
+
+e_eCU_DSCH_RES eCU_DSCH_Pack(t_eCU_DPK_Ctx* const p_ptCtx, const t_eCU_DSCH_Schema* p_ptSch, const void* p_pvStruct)
+{
+	/* Local variable */
+	e_eCU_DSCH_RES l_eRes;
+    t_eCU_DPK_Rec l_tRec;
+    const uint8_t* l_puStruct;
+    uint32_t l_uPackL;
+    uint32_t l_uFieldIdx;
+    uint32_t l_uRunL;
+    uint32_t l_uRunN;
+    bool_t l_bSameOrd;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptSch ) || ( NULL == p_pvStruct ) )
+	{
+		l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check the schema and get the size of the whole struct */
+        l_eRes = eCU_DSCH_CheckSchema(p_ptSch, &l_uPackL);
+
+        if( e_eCU_DSCH_RES_OK == l_eRes )
+        {
+            /* Only one check for the whole struct */
+            l_eRes = eCU_DSCH_ConvertDpkRes( eCU_DPK_ReserveRec(p_ptCtx, l_uPackL, &l_tRec) );
+
+            if( e_eCU_DSCH_RES_OK == l_eRes )
+            {
+                l_puStruct = (const uint8_t*) p_pvStruct;
+                l_bSameOrd = ( l_tRec.bIsLE == eCU_DPKPRV_IsHostLE() );
+                l_uFieldIdx = 0u;
+
+                while( l_uFieldIdx < p_ptSch->uFieldN )
+                {
+                    if( ( true == l_bSameOrd ) || ( 1u == p_ptSch->ptField[l_uFieldIdx].uElemL ) )
+                    {
+                        /* Copy together every contiguous field that doesn't need a byte swap */
+                        l_uRunL = eCU_DSCH_GetRunL(p_ptSch, l_uFieldIdx, l_bSameOrd, &l_uRunN);
+                        (void)memcpy(l_tRec.puCur, &l_puStruct[p_ptSch->ptField[l_uFieldIdx].uOff], l_uRunL);
+                    }
+                    else
+                    {
+                        /* Swap every element of the field */
+                        l_uRunL = p_ptSch->ptField[l_uFieldIdx].uElemL * p_ptSch->ptField[l_uFieldIdx].uCount;
+                        l_uRunN = 1u;
+                        eCU_DPKPRV_CopyElem(l_tRec.puCur, &l_puStruct[p_ptSch->ptField[l_uFieldIdx].uOff],
+                                            p_ptSch->ptField[l_uFieldIdx].uCount,
+                                            p_ptSch->ptField[l_uFieldIdx].uElemL, l_tRec.bIsLE);
+                    }
+
+                    l_tRec.puCur = &l_tRec.puCur[l_uRunL];
+                    l_uFieldIdx += l_uRunN;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eCU_DSCH_RES eCU_DSCH_Unpack(t_eCU_DUNPK_Ctx* const p_ptCtx, const t_eCU_DSCH_Schema* p_ptSch, void* p_pvStruct)
+{
+	/* Local variable */
+	e_eCU_DSCH_RES l_eRes;
+    t_eCU_DUNPK_Rec l_tRec;
+    uint8_t* l_puStruct;
+    uint32_t l_uPackL;
+    uint32_t l_uFieldIdx;
+    uint32_t l_uRunL;
+    uint32_t l_uRunN;
+    bool_t l_bSameOrd;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptSch ) || ( NULL == p_pvStruct ) )
+	{
+		l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check the schema and get the size of the whole struct */
+        l_eRes = eCU_DSCH_CheckSchema(p_ptSch, &l_uPackL);
+
+        if( e_eCU_DSCH_RES_OK == l_eRes )
+        {
+            /* Only one check for the whole struct */
+            l_eRes = eCU_DSCH_ConvertDunpkRes( eCU_DUNPK_GetRec(p_ptCtx, l_uPackL, &l_tRec) );
+
+            if( e_eCU_DSCH_RES_OK == l_eRes )
+            {
+                l_puStruct = (uint8_t*) p_pvStruct;
+                l_bSameOrd = ( l_tRec.bIsLE == eCU_DPKPRV_IsHostLE() );
+                l_uFieldIdx = 0u;
+
+                while( l_uFieldIdx < p_ptSch->uFieldN )
+                {
+                    if( ( true == l_bSameOrd ) || ( 1u == p_ptSch->ptField[l_uFieldIdx].uElemL ) )
+                    {
+                        /* Copy together every contiguous field that doesn't need a byte swap */
+                        l_uRunL = eCU_DSCH_GetRunL(p_ptSch, l_uFieldIdx, l_bSameOrd, &l_uRunN);
+                        (void)memcpy(&l_puStruct[p_ptSch->ptField[l_uFieldIdx].uOff], l_tRec.puCur, l_uRunL);
+                    }
+                    else
+                    {
+                        /* Swap every element of the field */
+                        l_uRunL = p_ptSch->ptField[l_uFieldIdx].uElemL * p_ptSch->ptField[l_uFieldIdx].uCount;
+                        l_uRunN = 1u;
+                        eCU_DPKPRV_CopyElem(&l_puStruct[p_ptSch->ptField[l_uFieldIdx].uOff], l_tRec.puCur,
+                                            p_ptSch->ptField[l_uFieldIdx].uCount,
+                                            p_ptSch->ptField[l_uFieldIdx].uElemL, l_tRec.bIsLE);
+                    }
+
+                    l_tRec.puCur = &l_tRec.puCur[l_uRunL];
+                    l_uFieldIdx += l_uRunN;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static e_eCU_DSCH_RES eCU_DSCH_CheckSchema(const t_eCU_DSCH_Schema* p_ptSch, uint32_t* const p_puPackL)
+{
+	/* Local variable */
+	e_eCU_DSCH_RES l_eRes;
+    const t_eCU_DSCH_Field* l_ptField;
+    uint32_t l_uFieldIdx;
+    uint32_t l_uFieldL;
+    uint32_t l_uPackL;
+
+    if( NULL == p_ptSch->ptField )
+    {
+        l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+    }
+    else if( ( p_ptSch->uFieldN <= 0u ) || ( p_ptSch->uStructL <= 0u ) )
+    {
+        l_eRes = e_eCU_DSCH_RES_BADPARAM;
+    }
+    else
+    {
+        l_eRes = e_eCU_DSCH_RES_OK;
+        l_uFieldIdx = 0u;
+        l_uPackL = 0u;
+
+        while( ( l_uFieldIdx < p_ptSch->uFieldN ) && ( e_eCU_DSCH_RES_OK == l_eRes ) )
+        {
+            l_ptField = &p_ptSch->ptField[l_uFieldIdx];
+
+            /* Check element size and number of element */
+            if( ( ( 1u != l_ptField->uElemL ) && ( 2u != l_ptField->uElemL ) && ( 4u != l_ptField->uElemL ) &&
+                  ( 8u != l_ptField->uElemL ) ) || ( l_ptField->uCount <= 0u ) ||
+                ( l_ptField->uCount > ( p_ptSch->uStructL / l_ptField->uElemL ) ) )
+            {
+                l_eRes = e_eCU_DSCH_RES_BADPARAM;
+            }
+            else
+            {
+                /* The field must be inside the struct, so the packed size can't overflow too */
+                l_uFieldL = l_ptField->uElemL * l_ptField->uCount;
+
+                if( l_ptField->uOff > ( p_ptSch->uStructL - l_uFieldL ) )
+                {
+                    l_eRes = e_eCU_DSCH_RES_BADPARAM;
+                }
+                else if( l_uFieldL > ( MAX_UINT32VAL - l_uPackL ) )
+                {
+                    l_eRes = e_eCU_DSCH_RES_BADPARAM;
+                }
+                else
+                {
+                    l_uPackL += l_uFieldL;
+                    l_uFieldIdx++;
+                }
+            }
+        }
+
+        if( e_eCU_DSCH_RES_OK == l_eRes )
+        {
+            *p_puPackL = l_uPackL;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eCU_DSCH_GetRunL(const t_eCU_DSCH_Schema* p_ptSch, const uint32_t p_uFieldIdx, const bool_t p_bSameOrd,
+                                 uint32_t* const p_puRunN)
+{
+	/* Local variable */
+    const t_eCU_DSCH_Field* l_ptNext;
+    uint32_t l_uRunL;
+    uint32_t l_uRunN;
+    bool_t l_bIsRun;
+
+    l_uRunL = p_ptSch->ptField[p_uFieldIdx].uElemL * p_ptSch->ptField[p_uFieldIdx].uCount;
+    l_uRunN = 1u;
+    l_bIsRun = true;
+
+    /* A field can be added to the run if it start where the run end, and doesn't need a byte swap */
+    while( ( ( p_uFieldIdx + l_uRunN ) < p_ptSch->uFieldN ) && ( true == l_bIsRun ) )
+    {
+        l_ptNext = &p_ptSch->ptField[p_uFieldIdx + l_uRunN];
+
+        if( ( l_ptNext->uOff == ( p_ptSch->ptField[p_uFieldIdx].uOff + l_uRunL ) ) &&
+            ( ( true == p_bSameOrd ) || ( 1u == l_ptNext->uElemL ) ) )
+        {
+            l_uRunL += l_ptNext->uElemL * l_ptNext->uCount;
+            l_uRunN++;
+        }
+        else
+        {
+            l_bIsRun = false;
+        }
+    }
+
+    *p_puRunN = l_uRunN;
+
+    return l_uRunL;
+}
+
+static e_eCU_DSCH_RES eCU_DSCH_ConvertDpkRes(const e_eCU_DPK_RES p_eDpkRes)
+{
+    e_eCU_DSCH_RES l_eRes;
+
+    switch( p_eDpkRes )
+    {
+        case e_eCU_DPK_RES_OK:
+        {
+            l_eRes = e_eCU_DSCH_RES_OK;
+            break;
+        }
+
+        case e_eCU_DPK_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_DSCH_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eCU_DPK_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eCU_DSCH_RES_CORRUPTCTX;
+            break;
+        }
+
+        case e_eCU_DPK_RES_OUTOFMEM:
+        {
+            l_eRes = e_eCU_DSCH_RES_OUTOFMEM;
+            break;
+        }
+
+        case e_eCU_DPK_RES_BADPOINTER:
+        {
+            l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eCU_DPK_RES_BADPARAM:
+        {
+            l_eRes = e_eCU_DSCH_RES_BADPARAM;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eCU_DSCH_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_DSCH_RES eCU_DSCH_ConvertDunpkRes(const e_eCU_DUNPK_RES p_eDunpkRes)
+{
+    e_eCU_DSCH_RES l_eRes;
+
+    switch( p_eDunpkRes )
+    {
+        case e_eCU_DUNPK_RES_OK:
+        {
+            l_eRes = e_eCU_DSCH_RES_OK;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_DSCH_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_NOINITFRAME:
+        {
+            l_eRes = e_eCU_DSCH_RES_NOINITFRAME;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eCU_DSCH_RES_CORRUPTCTX;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_NODATA:
+        {
+            l_eRes = e_eCU_DSCH_RES_NODATA;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_BADPOINTER:
+        {
+            l_eRes = e_eCU_DSCH_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eCU_DUNPK_RES_BADPARAM:
+        {
+            l_eRes = e_eCU_DSCH_RES_BADPARAM;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eCU_DSCH_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
\ No newline at end of file
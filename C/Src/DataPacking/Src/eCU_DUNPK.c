@@ -11,6 +11,7 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eCU_DUNPK.h"
+#include "eCU_DPKPRV.h"
 
 
 
@@ -18,6 +19,14 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eCU_DUNPK_IsStatusStillCoherent(const t_eCU_DUNPK_Ctx* p_ptCtx);
+static e_eCU_DUNPK_RES eCU_DUNPK_PopElem(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uToGetN,
+                                        const uint32_t p_uElemL);
+static e_eCU_DUNPK_RES eCU_DUNPK_PopVarElem(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uToGetN,
+                                           const uint32_t p_uElemL, const bool_t p_bIsSigned);
+static e_eCU_DUNPK_RES eCU_DUNPK_DecodeVar(const uint8_t* p_puSrc, const uint32_t p_uSrcL, const uint32_t p_uMaxL,
+                                          uint64_t* const p_puData, uint32_t* const p_puVarL);
+static void eCU_DUNPK_SetVarElem(uint8_t* p_puData, const uint64_t p_uData, const uint32_t p_uElemL,
+                                 const bool_t p_bIsSigned);
 
 
 
@@ -254,21 +263,21 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopArray(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_pu
 	e_eCU_DUNPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
             }
@@ -312,27 +321,42 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopArray(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_pu
 	return l_eRes;
 }
 
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU16(t_eCU_DUNPK_Ctx* const p_ptCtx, uint16_t* p_puData, const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopElem(p_ptCtx, (uint8_t*) p_puData, p_uToGetN, sizeof(uint16_t));
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData, const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopElem(p_ptCtx, (uint8_t*) p_puData, p_uToGetN, sizeof(uint32_t));
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData, const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopElem(p_ptCtx, (uint8_t*) p_puData, p_uToGetN, sizeof(uint64_t));
+}
+
 e_eCU_DUNPK_RES eCU_DUNPK_PopU8(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t *p_puData)
 {
 	/* Local variable */
 	e_eCU_DUNPK_RES l_eRes;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
             }
@@ -371,24 +395,23 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU16(t_eCU_DUNPK_Ctx* const p_ptCtx, uint16_t* p_puD
 {
 	/* Local variable */
 	e_eCU_DUNPK_RES l_eRes;
-    uint16_t l_uTemp;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
             }
@@ -408,31 +431,11 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU16(t_eCU_DUNPK_Ctx* const p_ptCtx, uint16_t* p_puD
                     }
                     else
                     {
-                        *p_puData = 0u;
-
-                        if( true == p_ptCtx->bIsLE)
-                        {
-                            /* Copy data Little endian */
-                            l_uTemp = (uint16_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x00FFu );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint16_t) ( ( (uint16_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0xFF00u );
-                            p_ptCtx->uMemUPKCtr++;
-                        }
-                        else
-                        {
-                            /* Copy data big endian */
-                            l_uTemp =  (uint16_t) ( ( (uint16_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0xFF00u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp = (uint16_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x00FFu );
-                            p_ptCtx->uMemUPKCtr++;
-                        }
+                        /* Copy data from the selected endianness */
+                        *p_puData = eCU_DPKPRV_LoadU16(&p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr], p_ptCtx->bIsLE);
 
+                        /* Update index */
+                        p_ptCtx->uMemUPKCtr += sizeof(uint16_t);
                         l_eRes = e_eCU_DUNPK_RES_OK;
                     }
                 }
@@ -447,24 +450,23 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puD
 {
 	/* Local variable */
 	e_eCU_DUNPK_RES l_eRes;
-    uint32_t l_uTemp;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
             }
@@ -484,47 +486,11 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puD
                     }
                     else
                     {
-                        *p_puData = 0u;
-
-                        if( true == p_ptCtx->bIsLE)
-                        {
-                            /* Copy data Little endian */
-                            l_uTemp = (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x000000FFu );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0x0000FF00u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 16u  );
-                            *p_puData |= ( l_uTemp & 0x00FF0000u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 24u  );
-                            *p_puData |= ( l_uTemp & 0xFF000000u );
-                            p_ptCtx->uMemUPKCtr++;
-                        }
-                        else
-                        {
-                            /* Copy data big endian */
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 24u  );
-                            *p_puData |= ( l_uTemp & 0xFF000000u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 16u  );
-                            *p_puData |= ( l_uTemp & 0x00FF0000u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint32_t) ( ( (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0x0000FF00u );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp = (uint32_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x000000FFu );
-                            p_ptCtx->uMemUPKCtr++;
-                        }
+                        /* Copy data from the selected endianness */
+                        *p_puData = eCU_DPKPRV_LoadU32(&p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr], p_ptCtx->bIsLE);
 
+                        /* Update index */
+                        p_ptCtx->uMemUPKCtr += sizeof(uint32_t);
                         l_eRes = e_eCU_DUNPK_RES_OK;
                     }
                 }
@@ -539,24 +505,23 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puD
 {
 	/* Local variable */
 	e_eCU_DUNPK_RES l_eRes;
-    uint64_t l_uTemp;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check internal status validity */
-            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
             }
@@ -576,85 +541,126 @@ e_eCU_DUNPK_RES eCU_DUNPK_PopU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puD
                     }
                     else
                     {
-                        *p_puData = 0u;
+                        /* Copy data from the selected endianness */
+                        *p_puData = eCU_DPKPRV_LoadU64(&p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr], p_ptCtx->bIsLE);
+
+                        /* Update index */
+                        p_ptCtx->uMemUPKCtr += sizeof(uint64_t);
+                        l_eRes = e_eCU_DUNPK_RES_OK;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_puData, 1u, sizeof(uint32_t), false);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_puData, 1u, sizeof(uint64_t), false);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarS32(t_eCU_DUNPK_Ctx* const p_ptCtx, int32_t* p_piData)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_piData, 1u, sizeof(int32_t), true);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopVarS64(t_eCU_DUNPK_Ctx* const p_ptCtx, int64_t* p_piData)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_piData, 1u, sizeof(int64_t), true);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarU32(t_eCU_DUNPK_Ctx* const p_ptCtx, uint32_t* p_puData,
+                                         const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_puData, p_uToGetN, sizeof(uint32_t), false);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarU64(t_eCU_DUNPK_Ctx* const p_ptCtx, uint64_t* p_puData,
+                                         const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_puData, p_uToGetN, sizeof(uint64_t), false);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarS32(t_eCU_DUNPK_Ctx* const p_ptCtx, int32_t* p_piData,
+                                         const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_piData, p_uToGetN, sizeof(int32_t), true);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_PopArrayVarS64(t_eCU_DUNPK_Ctx* const p_ptCtx, int64_t* p_piData,
+                                         const uint32_t p_uToGetN)
+{
+    return eCU_DUNPK_PopVarElem(p_ptCtx, (uint8_t*) p_piData, p_uToGetN, sizeof(int64_t), true);
+}
+
+e_eCU_DUNPK_RES eCU_DUNPK_GetRec(t_eCU_DUNPK_Ctx* const p_ptCtx, const uint32_t p_uRecL,
+                                 t_eCU_DUNPK_Rec* const p_ptRec)
+{
+	/* Local variable */
+	e_eCU_DUNPK_RES l_eRes;
 
-                        if( true == p_ptCtx->bIsLE)
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptRec ) )
+	{
+		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check Init */
+                if( p_ptCtx->uMemUPKFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_DUNPK_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Check data validity */
+                    if( p_uRecL <= 0u )
+                    {
+                        l_eRes = e_eCU_DUNPK_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Check if we can pop the whole record */
+                        if( p_uRecL > ( p_ptCtx->uMemUPKFrameL - p_ptCtx->uMemUPKCtr ) )
                         {
-                            /* Copy data Little endian */
-                            l_uTemp = (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x00000000000000FFUL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0x000000000000FF00UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 16u  );
-                            *p_puData |= ( l_uTemp & 0x0000000000FF0000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 24u  );
-                            *p_puData |= ( l_uTemp & 0x00000000FF000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 32u  );
-                            *p_puData |= ( l_uTemp & 0x000000FF00000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 40u  );
-                            *p_puData |= ( l_uTemp & 0x0000FF0000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 48u  );
-                            *p_puData |= ( l_uTemp & 0x00FF000000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 56u  );
-                            *p_puData |= ( l_uTemp & 0xFF00000000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
+                            l_eRes = e_eCU_DUNPK_RES_NODATA;
                         }
                         else
                         {
-                            /* Copy data big endian */
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 56u  );
-                            *p_puData |= ( l_uTemp & 0xFF00000000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 48u  );
-                            *p_puData |= ( l_uTemp & 0x00FF000000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 40u  );
-                            *p_puData |= ( l_uTemp & 0x0000FF0000000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 32u  );
-                            *p_puData |= ( l_uTemp & 0x000000FF00000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 24u  );
-                            *p_puData |= ( l_uTemp & 0x00000000FF000000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 16u  );
-                            *p_puData |= ( l_uTemp & 0x0000000000FF0000UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp =  (uint64_t) ( ( (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr] ) << 8u  );
-                            *p_puData |= ( l_uTemp & 0x000000000000FF00UL );
-                            p_ptCtx->uMemUPKCtr++;
-
-                            l_uTemp = (uint64_t) p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
-                            *p_puData |= ( l_uTemp & 0x00000000000000FFUL );
-                            p_ptCtx->uMemUPKCtr++;
-                        }
+                            /* Give the data to the record and count it as popped */
+                            p_ptRec->puCur = &p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr];
+                            p_ptRec->puEnd = &p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr + p_uRecL];
+                            p_ptRec->bIsLE = p_ptCtx->bIsLE;
+                            p_ptCtx->uMemUPKCtr += p_uRecL;
 
-                        l_eRes = e_eCU_DUNPK_RES_OK;
+                            l_eRes = e_eCU_DUNPK_RES_OK;
+                        }
                     }
                 }
             }
 		}
-	}
+    }
 
 	return l_eRes;
 }
@@ -687,4 +693,258 @@ static bool_t eCU_DUNPK_IsStatusStillCoherent(const t_eCU_DUNPK_Ctx* p_ptCtx)
 	}
 
     return l_eRes;
+}
+
+static e_eCU_DUNPK_RES eCU_DUNPK_PopElem(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uToGetN,
+                                        const uint32_t p_uElemL)
+{
+	/* Local variable */
+	e_eCU_DUNPK_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
+	{
+		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
+		{
+			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
+            {
+                l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check Init */
+                if( p_ptCtx->uMemUPKFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_DUNPK_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Check data validity */
+                    if( p_uToGetN <= 0u )
+                    {
+                        l_eRes = e_eCU_DUNPK_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Check if we can pop that amount, without overflowing */
+                        if( p_uToGetN > ( ( p_ptCtx->uMemUPKFrameL - p_ptCtx->uMemUPKCtr ) / p_uElemL ) )
+                        {
+                            l_eRes = e_eCU_DUNPK_RES_NODATA;
+                        }
+                        else
+                        {
+                            /* Copy data converting the endianness */
+                            eCU_DPKPRV_CopyElem(p_puData, &p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr], p_uToGetN,
+                                                p_uElemL, p_ptCtx->bIsLE);
+
+                            /* Update index */
+                            p_ptCtx->uMemUPKCtr += ( p_uToGetN * p_uElemL );
+                            l_eRes = e_eCU_DUNPK_RES_OK;
+                        }
+                    }
+                }
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+static e_eCU_DUNPK_RES eCU_DUNPK_PopVarElem(t_eCU_DUNPK_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uToGetN,
+                                           const uint32_t p_uElemL, const bool_t p_bIsSigned)
+{
+	/* Local variable */
+	e_eCU_DUNPK_RES l_eRes;
+    uint32_t l_uStartCtr;
+    uint32_t l_uElemIdx;
+    uint32_t l_uMaxL;
+    uint32_t l_uVarL;
+    uint64_t l_uData;
+
+	/* Check pointer validity */
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
+	{
+		l_eRes = e_eCU_DUNPK_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
+		{
+			l_eRes = e_eCU_DUNPK_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( ECU_HOTCHK( false == eCU_DUNPK_IsStatusStillCoherent(p_ptCtx) ) )
+            {
+                l_eRes = e_eCU_DUNPK_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check Init */
+                if( p_ptCtx->uMemUPKFrameL <= 0u )
+                {
+                    l_eRes = e_eCU_DUNPK_RES_NOINITFRAME;
+                }
+                else
+                {
+                    /* Check data validity */
+                    if( p_uToGetN <= 0u )
+                    {
+                        l_eRes = e_eCU_DUNPK_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        if( sizeof(uint32_t) == p_uElemL )
+                        {
+                            l_uMaxL = ECU_DUNPK_VAR32MAXL;
+                        }
+                        else
+                        {
+                            l_uMaxL = ECU_DUNPK_VAR64MAXL;
+                        }
+
+                        l_uStartCtr = p_ptCtx->uMemUPKCtr;
+                        l_uElemIdx = 0u;
+                        l_eRes = e_eCU_DUNPK_RES_OK;
+
+                        while( ( l_uElemIdx < p_uToGetN ) && ( e_eCU_DUNPK_RES_OK == l_eRes ) )
+                        {
+                            l_eRes = eCU_DUNPK_DecodeVar(&p_ptCtx->puMemUPK[p_ptCtx->uMemUPKCtr],
+                                                         ( p_ptCtx->uMemUPKFrameL - p_ptCtx->uMemUPKCtr ), l_uMaxL,
+                                                         &l_uData, &l_uVarL);
+
+                            if( e_eCU_DUNPK_RES_OK == l_eRes )
+                            {
+                                eCU_DUNPK_SetVarElem(&p_puData[l_uElemIdx * p_uElemL], l_uData, p_uElemL,
+                                                     p_bIsSigned);
+                                p_ptCtx->uMemUPKCtr += l_uVarL;
+                            }
+
+                            l_uElemIdx++;
+                        }
+
+                        if( e_eCU_DUNPK_RES_OK != l_eRes )
+                        {
+                            /* Nothing is popped */
+                            p_ptCtx->uMemUPKCtr = l_uStartCtr;
+                        }
+                    }
+                }
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+static e_eCU_DUNPK_RES eCU_DUNPK_DecodeVar(const uint8_t* p_puSrc, const uint32_t p_uSrcL, const uint32_t p_uMaxL,
+                                          uint64_t* const p_puData, uint32_t* const p_puVarL)
+{
+	/* Local variable */
+	e_eCU_DUNPK_RES l_eRes;
+    uint64_t l_uData;
+    uint32_t l_uLimit;
+    uint32_t l_uIdx;
+    bool_t l_bIsEnd;
+
+    /* Only one bound for the whole varint, the end of the frame or the max size of the type */
+    if( p_uSrcL < p_uMaxL )
+    {
+        l_uLimit = p_uSrcL;
+    }
+    else
+    {
+        l_uLimit = p_uMaxL;
+    }
+
+    l_uData = 0u;
+    l_uIdx = 0u;
+    l_bIsEnd = false;
+
+    while( ( l_uIdx < l_uLimit ) && ( false == l_bIsEnd ) )
+    {
+        l_uData |= ( (uint64_t) ( p_puSrc[l_uIdx] & 0x7Fu ) ) << ( 7u * l_uIdx );
+        l_bIsEnd = ( 0u == ( p_puSrc[l_uIdx] & 0x80u ) );
+        l_uIdx++;
+    }
+
+    if( false == l_bIsEnd )
+    {
+        if( l_uLimit < p_uMaxL )
+        {
+            /* The frame end before the varint */
+            l_eRes = e_eCU_DUNPK_RES_NODATA;
+        }
+        else
+        {
+            l_eRes = e_eCU_DUNPK_RES_BADDATA;
+        }
+    }
+    else
+    {
+        /* Last byte can only carry the remaining bit of the type */
+        if( ( ECU_DUNPK_VAR64MAXL == l_uIdx ) && ( p_puSrc[l_uIdx - 1u] > 0x01u ) )
+        {
+            l_eRes = e_eCU_DUNPK_RES_BADDATA;
+        }
+        else if( ( ECU_DUNPK_VAR32MAXL == p_uMaxL ) && ( l_uData > MAX_UINT32VAL ) )
+        {
+            l_eRes = e_eCU_DUNPK_RES_BADDATA;
+        }
+        else
+        {
+            *p_puData = l_uData;
+            *p_puVarL = l_uIdx;
+            l_eRes = e_eCU_DUNPK_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eCU_DUNPK_SetVarElem(uint8_t* p_puData, const uint64_t p_uData, const uint32_t p_uElemL,
+                                 const bool_t p_bIsSigned)
+{
+	/* Local variable */
+    uint32_t l_uData32;
+    int64_t l_iData64;
+    int32_t l_iData32;
+
+    if( sizeof(uint32_t) == p_uElemL )
+    {
+        if( true == p_bIsSigned )
+        {
+            l_iData32 = (int32_t) eCU_DPKPRV_ZigZagDec(p_uData);
+            (void)memcpy(p_puData, &l_iData32, sizeof(l_iData32));
+        }
+        else
+        {
+            l_uData32 = (uint32_t) p_uData;
+            (void)memcpy(p_puData, &l_uData32, sizeof(l_uData32));
+        }
+    }
+    else
+    {
+        if( true == p_bIsSigned )
+        {
+            l_iData64 = eCU_DPKPRV_ZigZagDec(p_uData);
+            (void)memcpy(p_puData, &l_iData64, sizeof(l_iData64));
+        }
+        else
+        {
+            (void)memcpy(p_puData, &p_uData, sizeof(p_uData));
+        }
+    }
 }
\ No newline at end of file
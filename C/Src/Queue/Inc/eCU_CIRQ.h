@@ -25,6 +25,15 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* ECU_CIRQ_ENABLESTATS is selected in eCU_CFG.h, never in the compiler options of a single project, because it change
+ * the layout of t_eCU_CIRQ_Ctx. When not defined the statistics fields and the eCU_CIRQ_GetStats function are not
+ * compiled at all. */
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS
  **********************************************************************************************************************/
@@ -39,6 +48,24 @@ typedef enum
     e_eCU_CIRQ_RES_NOINITLIB,
 }e_eCU_CIRQ_RES;
 
+#ifdef ECU_CIRQ_ENABLESTATS
+typedef struct
+{
+    /* Producer side, updated only by eCU_CIRQ_InsertData */
+    uint64_t uInBytes;
+    uint32_t uInsertCall;
+    uint32_t uFullRej;
+    uint32_t uPeakUsedL;
+    uint32_t uInWrapCopy;
+
+    /* Consumer side, updated only by eCU_CIRQ_RetriveData and eCU_CIRQ_PeekData */
+    uint64_t uOutBytes;
+    uint32_t uRetriveCall;
+    uint32_t uEmptyRej;
+    uint32_t uOutWrapCopy;
+}t_eCU_CIRQ_Stats;
+#endif
+
 typedef struct
 {
     bool_t   bIsInit;
@@ -46,6 +73,9 @@ typedef struct
     uint32_t uBuffL;
     uint32_t uBuffUsedL;
     uint32_t uBuffFreeIdx;
+#ifdef ECU_CIRQ_ENABLESTATS
+    t_eCU_CIRQ_Stats tStats;
+#endif
 }t_eCU_CIRQ_Ctx;
 
 
@@ -131,6 +161,39 @@ e_eCU_CIRQ_RES eCU_CIRQ_GetOccupiedSapce(t_eCU_CIRQ_Ctx* const p_ptCtx, uint32_t
  */
 e_eCU_CIRQ_RES eCU_CIRQ_InsertData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL);
 
+/**
+ * @brief       Get the contiguous free area of the queue where data can be written directly, without copying it with
+ *              eCU_CIRQ_InsertData. The area start after the last inserted byte and finish at the end of the buffer or
+ *              at the first occupied byte, so when the free space wrap the remaining part is returned by another call
+ *              after eCU_CIRQ_CommitData. Written data is not part of the queue until it's committed.
+ *
+ * @param[in]   p_ptCtx     - Circular queue context
+ * @param[out]  p_ppuSeg    - Pointer to a pointer that will point to the start of the contiguous free area
+ * @param[out]  p_puSegL    - Pointer to a variable where the size of the contiguous free area will be stored, zero
+ *                            when the queue is full
+ *
+ * @return      e_eCU_CIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_CIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQ_RES eCU_CIRQ_GetFreeSeg(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t** p_ppuSeg, uint32_t* const p_puSegL);
+
+/**
+ * @brief       Insert in the queue p_uDataL byte already written in the area returned by eCU_CIRQ_GetFreeSeg
+ *
+ * @param[in]   p_ptCtx     - Circular queue context
+ * @param[in]   p_uDataL    - Number of byte written, not bigger than the size returned by eCU_CIRQ_GetFreeSeg
+ *
+ * @return      e_eCU_CIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *              e_eCU_CIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_CIRQ_RES_FULL         - Queue full, can't commit this amount of data
+ *		        e_eCU_CIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQ_RES eCU_CIRQ_CommitData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint32_t p_uDataL);
+
 /**
  * @brief       Retrive data from the queue if avaiable
  *
@@ -147,6 +210,40 @@ e_eCU_CIRQ_RES eCU_CIRQ_InsertData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t*
  */
 e_eCU_CIRQ_RES eCU_CIRQ_RetriveData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL);
 
+/**
+ * @brief       Get the contiguous occupied area of the queue, so data can be used directly without copying it with
+ *              eCU_CIRQ_RetriveData. The area start from the oldest byte and finish at the end of the buffer or at the
+ *              last inserted byte, so when the data wrap the remaining part is returned by another call after
+ *              eCU_CIRQ_DiscardData. Data is not removed from the queue until it's discharged.
+ *
+ * @param[in]   p_ptCtx     - Circular queue context
+ * @param[out]  p_ppuSeg    - Pointer to a pointer that will point to the oldest byte of the queue
+ * @param[out]  p_puSegL    - Pointer to a variable where the size of the contiguous occupied area will be stored, zero
+ *                            when the queue is empty
+ *
+ * @return      e_eCU_CIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_CIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQ_RES eCU_CIRQ_GetOccupiedSeg(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t** p_ppuSeg,
+                                       uint32_t* const p_puSegL);
+
+/**
+ * @brief       Remove from the queue the p_uDataL oldest byte without copying them
+ *
+ * @param[in]   p_ptCtx     - Circular queue context
+ * @param[in]   p_uDataL    - Number of byte to remove
+ *
+ * @return      e_eCU_CIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *              e_eCU_CIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_CIRQ_RES_EMPTY        - Not so many byte present in queue
+ *		        e_eCU_CIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQ_RES eCU_CIRQ_DiscardData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint32_t p_uDataL);
+
 /**
  * @brief       Peek data from the queue if avaiable
  *
@@ -163,6 +260,24 @@ e_eCU_CIRQ_RES eCU_CIRQ_RetriveData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_pu
  */
 e_eCU_CIRQ_RES eCU_CIRQ_PeekData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL);
 
+#ifdef ECU_CIRQ_ENABLESTATS
+/**
+ * @brief       Get a snapshot of the statistics of the queue. Statistics are cleared only by eCU_CIRQ_InitCtx, so they
+ *              are kept across eCU_CIRQ_Reset. Only successful insert and retrive are counted in uInsertCall,
+ *              uRetriveCall, uInBytes and uOutBytes, while rejected operation are counted in uFullRej and uEmptyRej.
+ *              uPeakUsedL is the max number of byte ever stored in the queue, and can be used to size the queue.
+ *
+ * @param[in]   p_ptCtx       - Circular queue context
+ * @param[out]  p_ptStats     - Pointer to a t_eCU_CIRQ_Stats where the statistics will be copied
+ *
+ * @return      e_eCU_CIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_CIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQ_RES eCU_CIRQ_GetStats(t_eCU_CIRQ_Ctx* const p_ptCtx, t_eCU_CIRQ_Stats* const p_ptStats);
+#endif
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,157 @@
+/**
+ * @file       eCU_CIRQS.h
+ *
+ * @brief      Circular queue set utils. Manage a group of circular queues keeping a bitmap of the queues that contains
+ *             data, so the consumer can find the non empty queues without polling every queue of the set.
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CIRQS_H
+#define ECU_CIRQS_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+#include "eCU_CIRQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Number of uint32_t words needed to store the ready bitmap of a set of p_uQueueN queues */
+#define ECU_CIRQS_READYMAPL(p_uQueueN)                                      ( ( ( ( uint32_t )( p_uQueueN ) ) + 31u ) / 32u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_CIRQS_RES_OK = 0,
+    e_eCU_CIRQS_RES_BADPARAM,
+    e_eCU_CIRQS_RES_BADPOINTER,
+	e_eCU_CIRQS_RES_CORRUPTCTX,
+	e_eCU_CIRQS_RES_FULL,
+    e_eCU_CIRQS_RES_EMPTY,
+    e_eCU_CIRQS_RES_NOINITLIB,
+}e_eCU_CIRQS_RES;
+
+typedef struct
+{
+    uint32_t uQueueIdx;
+    uint32_t uDataOffset;
+    uint32_t uDataL;
+}t_eCU_CIRQS_Drain;
+
+typedef struct
+{
+    bool_t          bIsInit;
+    t_eCU_CIRQ_Ctx* ptQueue;
+    uint32_t        uQueueN;
+    uint32_t*       puReadyMap;
+    uint32_t        uNextQueue;
+}t_eCU_CIRQS_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the circular queue set context. Every queue of the array must be already initialized, and
+ *              after this call data must be inserted only using eCU_CIRQS_InsertData, otherwise the ready bitmap will
+ *              not be updated.
+ *
+ * @param[in]   p_ptCtx        - Circular queue set context
+ * @param[in]   p_ptQueue      - Pointer to an array of already initialized circular queue contexts
+ * @param[in]   p_uQueueN      - Number of queues present in p_ptQueue
+ * @param[in]   p_puReadyMap   - Pointer to an array of uint32_t that will be used to store the ready bitmap
+ * @param[in]   p_uReadyMapL   - Number of uint32_t present in p_puReadyMap, must be at least
+ *                               ECU_CIRQS_READYMAPL(p_uQueueN)
+ *
+ * @return      e_eCU_CIRQS_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *              e_eCU_CIRQS_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_CIRQS_RES_NOINITLIB    - One of the queue of the set is not initialized
+ *		        e_eCU_CIRQS_RES_CORRUPTCTX   - One of the queue of the set has a corrupted context
+ *              e_eCU_CIRQS_RES_OK           - Circular queue set initialized successfully
+ */
+e_eCU_CIRQS_RES eCU_CIRQS_InitCtx(t_eCU_CIRQS_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* p_ptQueue, const uint32_t p_uQueueN,
+                                  uint32_t* p_puReadyMap, const uint32_t p_uReadyMapL);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Circular queue set context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eCU_CIRQS_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_CIRQS_RES_OK            - Operation ended correctly
+ */
+e_eCU_CIRQS_RES eCU_CIRQS_IsInit(t_eCU_CIRQS_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Insert data in a queue of the set and mark the queue as ready
+ *
+ * @param[in]   p_ptCtx     - Circular queue set context
+ * @param[in]   p_uQueueIdx - Index of the queue where the data will be inserted
+ * @param[in]   p_puData    - Pointer to the data that we want to insert in the queue
+ * @param[in]   p_uDataL    - Lenght of the data present in the pointer passed
+ *
+ * @return      e_eCU_CIRQS_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQS_RES_NOINITLIB    - Need to init the queue set before taking some action
+ *              e_eCU_CIRQS_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_CIRQS_RES_FULL         - Queue full, can't push this amount of data
+ *		        e_eCU_CIRQS_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQS_RES_OK           - Operation ended successfully
+ */
+e_eCU_CIRQS_RES eCU_CIRQS_InsertData(t_eCU_CIRQS_Ctx* const p_ptCtx, const uint32_t p_uQueueIdx,
+                                     const uint8_t* p_puData, const uint32_t p_uDataL);
+
+/**
+ * @brief       Drain data from every queue marked as ready. Ready queues are found scanning the ready bitmap one word
+ *              at a time, and the scan starts from the queue after the last one drained by the previous call, so every
+ *              queue get the same chance to be drained. Data of every drained queue are copied one after the other in
+ *              p_puDest, and for every drained queue an element of p_ptDrain is filled with the queue index and the
+ *              position of the data in p_puDest. A queue is removed from the ready bitmap when it became empty.
+ *
+ * @param[in]   p_ptCtx         - Circular queue set context
+ * @param[out]  p_puDest        - Pointer to the buffer that will contain the drained data
+ * @param[in]   p_uDestL        - Dimension in byte of p_puDest
+ * @param[in]   p_uMaxQueueL    - Max number of byte that will be drained from a single queue
+ * @param[out]  p_ptDrain       - Pointer to an array of t_eCU_CIRQS_Drain that will describe the drained data
+ * @param[in]   p_uDrainMaxN    - Number of elements present in p_ptDrain
+ * @param[out]  p_puDrainN      - Pointer to a uint32_t where the number of filled element of p_ptDrain will be placed
+ *
+ * @return      e_eCU_CIRQS_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_CIRQS_RES_NOINITLIB    - Need to init the queue set before taking some action
+ *              e_eCU_CIRQS_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_CIRQS_RES_EMPTY        - No queue of the set has data
+ *		        e_eCU_CIRQS_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_CIRQS_RES_OK           - Operation ended successfully, at least one queue was drained
+ */
+e_eCU_CIRQS_RES eCU_CIRQS_DrainReady(t_eCU_CIRQS_Ctx* const p_ptCtx, uint8_t* p_puDest, const uint32_t p_uDestL,
+                                     const uint32_t p_uMaxQueueL, t_eCU_CIRQS_Drain* p_ptDrain,
+                                     const uint32_t p_uDrainMaxN, uint32_t* const p_puDrainN);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CIRQS_H */
\ No newline at end of file
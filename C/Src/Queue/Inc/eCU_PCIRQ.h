@@ -0,0 +1,211 @@
+/**
+ * @file       eCU_PCIRQ.h
+ *
+ * @brief      Persistent circular queue utils. The queue data and the queue indexes are stored in the same memory
+ *             area passed by the user ( e.g. retained RAM, backup SRAM or a memory mapped file ), so that the queue
+ *             content can be recovered after a reset of the application.
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_PCIRQ_H
+#define ECU_PCIRQ_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+#include "eCU_CIRQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Size of the header placed at the start of the memory area. The header is composed by two copies of the queue indexes
+ * ( sequence number, used space, free index and CRC 32 ), that are written alternately. In this way an interrupted
+ * header write never destroy the last valid status of the queue.
+ * The header is written only after the data it describe, with ECU_PCIRQ_MEMBARRIER ( see eCU_CFG.h ) between the two
+ * write. The default barrier stop only the compiler: when the memory area is retained RAM or backup SRAM placed behind
+ * a write buffer or a data cache, the barrier must be a hardware one and the area must be non cacheable or written
+ * through, otherwise after a reset the header could describe data that never reached the memory. */
+#define ECU_PCIRQ_HEADERL                                                                       ( ( uint32_t ) 32u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eCU_PCIRQ_RES_OK = 0,
+    e_eCU_PCIRQ_RES_BADPARAM,
+    e_eCU_PCIRQ_RES_BADPOINTER,
+	e_eCU_PCIRQ_RES_CORRUPTCTX,
+	e_eCU_PCIRQ_RES_FULL,
+    e_eCU_PCIRQ_RES_EMPTY,
+    e_eCU_PCIRQ_RES_NOINITLIB,
+    e_eCU_PCIRQ_RES_NOVALIDHEADER,
+}e_eCU_PCIRQ_RES;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    uint8_t* puMem;
+    uint32_t uSeq;
+    t_eCU_CIRQ_Ctx tCirq;
+}t_eCU_PCIRQ_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the persistent circular queue context, formatting the memory area as an empty queue. Every
+ *              data previously stored in the memory area is discharged.
+ *
+ * @param[in]   p_ptCtx   - Persistent circular queue context
+ * @param[in]   p_puMem   - Pointer to a memory buffer that we will use to store the header and the queue data
+ * @param[in]   p_uMemL   - Dimension in byte of the memory buffer, must be greater than ECU_PCIRQ_HEADERL
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *              e_eCU_PCIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *              e_eCU_PCIRQ_RES_OK           - Persistent circular queue initialized successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_InitCtx(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puMem, const uint32_t p_uMemL);
+
+/**
+ * @brief       Initialize the persistent circular queue context recovering the status saved in the memory area. Only
+ *              the header is verified ( CRC 32 and index limits ), so the recovery time doesn't depend on the
+ *              dimension of the queue. If the last written header is not valid the previous one is used.
+ *
+ * @param[in]   p_ptCtx   - Persistent circular queue context
+ * @param[in]   p_puMem   - Pointer to the memory buffer used by a previous session of the queue
+ * @param[in]   p_uMemL   - Dimension in byte of the memory buffer, must be the same of the previous session
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_PCIRQ_RES_BADPARAM      - In case of bad parameter passed to the function
+ *              e_eCU_PCIRQ_RES_NOVALIDHEADER - No valid header found, the queue must be initialized using
+ *                                              eCU_PCIRQ_InitCtx
+ *              e_eCU_PCIRQ_RES_OK            - Persistent circular queue recovered successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_RecoverCtx(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puMem, const uint32_t p_uMemL);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Persistent circular queue context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eCU_PCIRQ_RES_OK            - Operation ended correctly
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_IsInit(t_eCU_PCIRQ_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Reset the state of the persistent circular queue and discharge all saved data
+ *
+ * @param[in]   p_ptCtx         - Persistent circular queue context
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Persistent circular queue resetted successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_Reset(t_eCU_PCIRQ_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Get free space present in the queue
+ *
+ * @param[in]   p_ptCtx           - Persistent circular queue context
+ * @param[out]  p_puFreeSpace     - Pointer to variable where free space present in queue will be stored
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_GetFreeSapce(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint32_t* const p_puFreeSpace);
+
+/**
+ * @brief       Get used space present in the queue
+ *
+ * @param[in]   p_ptCtx         - Persistent circular queue context
+ * @param[out]  p_puUsedSpace   - Pointer to variable where used space present in queue will be stored
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_GetOccupiedSapce(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint32_t* const p_puUsedSpace);
+
+/**
+ * @brief       Insert data in the queue if free space is avaiable. Data are copied before updating the header, so an
+ *              interruption during this function will leave the queue in the previous status.
+ *
+ * @param[in]   p_ptCtx     - Persistent circular queue context
+ * @param[in]   p_puData    - Pointer to the data that we want to insert in the queue
+ * @param[in]   p_uDataL    - Lenght of the data present in the pointer passed
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *              e_eCU_PCIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_PCIRQ_RES_FULL         - Queue full, can't push this amount of data
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_InsertData(t_eCU_PCIRQ_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL);
+
+/**
+ * @brief       Retrive data from the queue if avaiable. If an interruption happens before the header is updated the
+ *              retrived data will be still present in the queue after the recovery.
+ *
+ * @param[in]   p_ptCtx        - Persistent circular queue context
+ * @param[out]  p_puData       - Pointer to the buffer that will contain retrived data from queue
+ * @param[in]   p_uDataL       - Lenght of the data that we want to retrive
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *              e_eCU_PCIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_PCIRQ_RES_EMPTY        - Not so many byte present in queue
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_RetriveData(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL);
+
+/**
+ * @brief       Peek data from the queue if avaiable
+ *
+ * @param[in]   p_ptCtx       - Persistent circular queue context
+ * @param[out]  p_puData      - Pointer to the buffer that will contain retrived data from queue
+ * @param[in]   p_uDataL      - Lenght of the data that we want to peek
+ *
+ * @return      e_eCU_PCIRQ_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eCU_PCIRQ_RES_NOINITLIB    - Need to init the queue before taking some action
+ *              e_eCU_PCIRQ_RES_BADPARAM     - In case of bad parameter passed to the function
+ *		        e_eCU_PCIRQ_RES_EMPTY        - Not so many byte present in queue
+ *		        e_eCU_PCIRQ_RES_CORRUPTCTX   - In case of an corrupted context
+ *              e_eCU_PCIRQ_RES_OK           - Operation ended successfully
+ */
+e_eCU_PCIRQ_RES eCU_PCIRQ_PeekData(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_PCIRQ_H */
\ No newline at end of file
@@ -50,6 +50,9 @@ e_eCU_CIRQ_RES eCU_CIRQ_InitCtx(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puBuff
 			p_ptCtx->uBuffL = p_uBuffL;
 			p_ptCtx->uBuffUsedL = 0u;
 			p_ptCtx->uBuffFreeIdx = 0u;
+#ifdef ECU_CIRQ_ENABLESTATS
+            (void)memset(&p_ptCtx->tStats, 0, sizeof(t_eCU_CIRQ_Stats));
+#endif
 
 			l_eRes = e_eCU_CIRQ_RES_OK;
 		}
@@ -194,21 +197,21 @@ e_eCU_CIRQ_RES eCU_CIRQ_InsertData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t*
 	uint32_t l_uSecondLen;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check data coherence */
-            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
             }
@@ -226,6 +229,9 @@ e_eCU_CIRQ_RES eCU_CIRQ_InsertData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t*
                     {
                         /* No memory avaiable */
                         l_eRes = e_eCU_CIRQ_RES_FULL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uFullRej++;
+#endif
                     }
                     else
                     {
@@ -255,9 +261,133 @@ e_eCU_CIRQ_RES eCU_CIRQ_InsertData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t*
                             l_uSecondLen = p_uDataL - l_uFirstLen;
                             (void)memcpy(&p_ptCtx->puBuff[p_ptCtx->uBuffFreeIdx], &p_puData[l_uFirstLen], l_uSecondLen);
                             p_ptCtx->uBuffFreeIdx += l_uSecondLen;
+#ifdef ECU_CIRQ_ENABLESTATS
+                            p_ptCtx->tStats.uInWrapCopy++;
+#endif
+                        }
+
+                        p_ptCtx->uBuffUsedL += p_uDataL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uInBytes += p_uDataL;
+                        p_ptCtx->tStats.uInsertCall++;
+                        if( p_ptCtx->uBuffUsedL > p_ptCtx->tStats.uPeakUsedL )
+                        {
+                            p_ptCtx->tStats.uPeakUsedL = p_ptCtx->uBuffUsedL;
+                        }
+#endif
+                        l_eRes = e_eCU_CIRQ_RES_OK;
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQ_RES eCU_CIRQ_GetFreeSeg(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t** p_ppuSeg, uint32_t* const p_puSegL)
+{
+	/* Local variable */
+	e_eCU_CIRQ_RES l_eRes;
+	uint32_t l_uFreeSpace;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuSeg ) || ( NULL == p_puSegL ) )
+	{
+		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* The free area start at the free index and can't go beyond the end of the buffer */
+                l_uFreeSpace = p_ptCtx->uBuffL - p_ptCtx->uBuffUsedL;
+                if( l_uFreeSpace > ( p_ptCtx->uBuffL - p_ptCtx->uBuffFreeIdx ) )
+                {
+                    l_uFreeSpace = p_ptCtx->uBuffL - p_ptCtx->uBuffFreeIdx;
+                }
+
+                *p_ppuSeg = &p_ptCtx->puBuff[p_ptCtx->uBuffFreeIdx];
+                *p_puSegL = l_uFreeSpace;
+                l_eRes = e_eCU_CIRQ_RES_OK;
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQ_RES eCU_CIRQ_CommitData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_CIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uDataL <= 0u )
+                {
+                    l_eRes = e_eCU_CIRQ_RES_BADPARAM;
+                }
+                else
+                {
+                    if( p_uDataL > ( p_ptCtx->uBuffL - p_ptCtx->uBuffUsedL ) )
+                    {
+                        /* No memory avaiable */
+                        l_eRes = e_eCU_CIRQ_RES_FULL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uFullRej++;
+#endif
+                    }
+                    else
+                    {
+                        /* Data is already in place, only the index must be updated */
+                        p_ptCtx->uBuffFreeIdx += p_uDataL;
+                        if( p_ptCtx->uBuffFreeIdx >= p_ptCtx->uBuffL )
+                        {
+                            p_ptCtx->uBuffFreeIdx -= p_ptCtx->uBuffL;
                         }
 
                         p_ptCtx->uBuffUsedL += p_uDataL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uInBytes += p_uDataL;
+                        p_ptCtx->tStats.uInsertCall++;
+                        if( p_ptCtx->uBuffUsedL > p_ptCtx->tStats.uPeakUsedL )
+                        {
+                            p_ptCtx->tStats.uPeakUsedL = p_ptCtx->uBuffUsedL;
+                        }
+#endif
                         l_eRes = e_eCU_CIRQ_RES_OK;
                     }
                 }
@@ -277,21 +407,21 @@ e_eCU_CIRQ_RES eCU_CIRQ_RetriveData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_pu
     uint32_t l_uMemPOccIdx;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check data coherence */
-            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
             }
@@ -308,6 +438,9 @@ e_eCU_CIRQ_RES eCU_CIRQ_RetriveData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_pu
                     {
                         /* No enoght data in the queue */
                         l_eRes = e_eCU_CIRQ_RES_EMPTY;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uEmptyRej++;
+#endif
                     }
                     else
                     {
@@ -332,9 +465,122 @@ e_eCU_CIRQ_RES eCU_CIRQ_RetriveData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_pu
                             /* Second round */
                             l_uSecondLen = p_uDataL - l_uFirstLen;
                             (void)memcpy(&p_puData[l_uFirstLen], &p_ptCtx->puBuff[l_uMemPOccIdx], l_uSecondLen);
+#ifdef ECU_CIRQ_ENABLESTATS
+                            p_ptCtx->tStats.uOutWrapCopy++;
+#endif
                         }
 
                         p_ptCtx->uBuffUsedL -= p_uDataL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uOutBytes += p_uDataL;
+                        p_ptCtx->tStats.uRetriveCall++;
+#endif
+                        l_eRes = e_eCU_CIRQ_RES_OK;
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQ_RES eCU_CIRQ_GetOccupiedSeg(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint8_t** p_ppuSeg,
+                                       uint32_t* const p_puSegL)
+{
+	/* Local variable */
+	e_eCU_CIRQ_RES l_eRes;
+	uint32_t l_uMemPOccIdx;
+	uint32_t l_uUsedL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuSeg ) || ( NULL == p_puSegL ) )
+	{
+		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* The occupied area start at the occupied index and can't go beyond the end of the buffer */
+                l_uMemPOccIdx = eCU_CIRQ_GetoccupiedIndex(p_ptCtx);
+                l_uUsedL = p_ptCtx->uBuffUsedL;
+                if( l_uUsedL > ( p_ptCtx->uBuffL - l_uMemPOccIdx ) )
+                {
+                    l_uUsedL = p_ptCtx->uBuffL - l_uMemPOccIdx;
+                }
+
+                *p_ppuSeg = &p_ptCtx->puBuff[l_uMemPOccIdx];
+                *p_puSegL = l_uUsedL;
+                l_eRes = e_eCU_CIRQ_RES_OK;
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQ_RES eCU_CIRQ_DiscardData(t_eCU_CIRQ_Ctx* const p_ptCtx, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_CIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uDataL <= 0u )
+                {
+                    l_eRes = e_eCU_CIRQ_RES_BADPARAM;
+                }
+                else
+                {
+                    if( p_uDataL > p_ptCtx->uBuffUsedL )
+                    {
+                        /* No enoght data in the queue */
+                        l_eRes = e_eCU_CIRQ_RES_EMPTY;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uEmptyRej++;
+#endif
+                    }
+                    else
+                    {
+                        /* The occupied index follow the used lenght, nothing to copy */
+                        p_ptCtx->uBuffUsedL -= p_uDataL;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uOutBytes += p_uDataL;
+                        p_ptCtx->tStats.uRetriveCall++;
+#endif
                         l_eRes = e_eCU_CIRQ_RES_OK;
                     }
                 }
@@ -354,21 +600,21 @@ e_eCU_CIRQ_RES eCU_CIRQ_PeekData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puDat
     uint32_t l_uMemPOccIdx;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	if( ECU_HOTCHK( ( NULL == p_ptCtx ) || ( NULL == p_puData ) ) )
 	{
 		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check Init */
-		if( false == p_ptCtx->bIsInit )
+		if( ECU_HOTCHK( false == p_ptCtx->bIsInit ) )
 		{
 			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
 		}
 		else
 		{
             /* Check data coherence */
-            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            if( ECU_HOTCHK( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) ) )
             {
                 l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
             }
@@ -385,6 +631,9 @@ e_eCU_CIRQ_RES eCU_CIRQ_PeekData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puDat
                     {
                         /* No enoght data in the queue */
                         l_eRes = e_eCU_CIRQ_RES_EMPTY;
+#ifdef ECU_CIRQ_ENABLESTATS
+                        p_ptCtx->tStats.uEmptyRej++;
+#endif
                     }
                     else
                     {
@@ -409,6 +658,9 @@ e_eCU_CIRQ_RES eCU_CIRQ_PeekData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puDat
                             /* Second round */
                             l_uSecondLen = p_uDataL - l_uFirstLen;
                             (void)memcpy(&p_puData[l_uFirstLen], &p_ptCtx->puBuff[l_uMemPOccIdx], l_uSecondLen);
+#ifdef ECU_CIRQ_ENABLESTATS
+                            p_ptCtx->tStats.uOutWrapCopy++;
+#endif
                         }
 
                         l_eRes = e_eCU_CIRQ_RES_OK;
@@ -421,6 +673,43 @@ e_eCU_CIRQ_RES eCU_CIRQ_PeekData(t_eCU_CIRQ_Ctx* const p_ptCtx, uint8_t* p_puDat
 	return l_eRes;
 }
 
+#ifdef ECU_CIRQ_ENABLESTATS
+e_eCU_CIRQ_RES eCU_CIRQ_GetStats(t_eCU_CIRQ_Ctx* const p_ptCtx, t_eCU_CIRQ_Stats* const p_ptStats)
+{
+	/* Local variable */
+	e_eCU_CIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptStats ) )
+	{
+		l_eRes = e_eCU_CIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_ptStats = p_ptCtx->tStats;
+				l_eRes = e_eCU_CIRQ_RES_OK;
+			}
+		}
+    }
+
+	return l_eRes;
+}
+#endif
+
 
 
 /***********************************************************************************************************************
@@ -0,0 +1,429 @@
+/**
+ * @file       eCU_CIRQS.c
+ *
+ * @brief      Circular queue set utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CIRQS.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_CIRQS_IsStatusStillCoherent(const t_eCU_CIRQS_Ctx* p_ptCtx);
+static e_eCU_CIRQS_RES eCU_CIRQS_ConvertRes(const e_eCU_CIRQ_RES p_eCirqRes);
+static uint32_t eCU_CIRQS_GetLowestBit(const uint32_t p_uWord);
+static e_eCU_CIRQS_RES eCU_CIRQS_DrainQueue(t_eCU_CIRQS_Ctx* const p_ptCtx, const uint32_t p_uQueueIdx,
+                                            uint8_t* p_puDest, const uint32_t p_uMaxL, uint32_t* const p_puDrainedL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_CIRQS_RES eCU_CIRQS_InitCtx(t_eCU_CIRQS_Ctx* const p_ptCtx, t_eCU_CIRQ_Ctx* p_ptQueue, const uint32_t p_uQueueN,
+                                  uint32_t* p_puReadyMap, const uint32_t p_uReadyMapL)
+{
+	/* Local variable */
+	e_eCU_CIRQS_RES l_eRes;
+    uint32_t l_uIdx;
+    uint32_t l_uUsedL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptQueue ) || ( NULL == p_puReadyMap ) )
+	{
+		l_eRes = e_eCU_CIRQS_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( p_uQueueN <= 0u ) || ( p_uReadyMapL < ECU_CIRQS_READYMAPL(p_uQueueN) ) )
+		{
+			l_eRes = e_eCU_CIRQS_RES_BADPARAM;
+		}
+		else
+		{
+            /* Build the ready bitmap using the current status of every queue */
+            (void)memset(p_puReadyMap, 0, ( sizeof(uint32_t) * ECU_CIRQS_READYMAPL(p_uQueueN) ) );
+            l_eRes = e_eCU_CIRQS_RES_OK;
+            l_uIdx = 0u;
+
+            while( ( l_uIdx < p_uQueueN ) && ( e_eCU_CIRQS_RES_OK == l_eRes ) )
+            {
+                l_eRes = eCU_CIRQS_ConvertRes( eCU_CIRQ_GetOccupiedSapce(&p_ptQueue[l_uIdx], &l_uUsedL) );
+
+                if( ( e_eCU_CIRQS_RES_OK == l_eRes ) && ( l_uUsedL > 0u ) )
+                {
+                    p_puReadyMap[l_uIdx / 32u] |= ( ( uint32_t ) 1u ) << ( l_uIdx % 32u );
+                }
+
+                l_uIdx++;
+            }
+
+            if( e_eCU_CIRQS_RES_OK == l_eRes )
+            {
+                p_ptCtx->bIsInit = true;
+                p_ptCtx->ptQueue = p_ptQueue;
+                p_ptCtx->uQueueN = p_uQueueN;
+                p_ptCtx->puReadyMap = p_puReadyMap;
+                p_ptCtx->uNextQueue = 0u;
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQS_RES eCU_CIRQS_IsInit(t_eCU_CIRQS_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_CIRQS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_CIRQS_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_CIRQS_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_CIRQS_RES eCU_CIRQS_InsertData(t_eCU_CIRQS_Ctx* const p_ptCtx, const uint32_t p_uQueueIdx,
+                                     const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_CIRQS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eCU_CIRQS_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQS_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQS_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQS_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( p_uQueueIdx >= p_ptCtx->uQueueN )
+                {
+                    l_eRes = e_eCU_CIRQS_RES_BADPARAM;
+                }
+                else
+                {
+                    l_eRes = eCU_CIRQS_ConvertRes( eCU_CIRQ_InsertData(&p_ptCtx->ptQueue[p_uQueueIdx], p_puData,
+                                                                       p_uDataL) );
+
+                    if( e_eCU_CIRQS_RES_OK == l_eRes )
+                    {
+                        /* The queue has data now */
+                        p_ptCtx->puReadyMap[p_uQueueIdx / 32u] |= ( ( uint32_t ) 1u ) << ( p_uQueueIdx % 32u );
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_CIRQS_RES eCU_CIRQS_DrainReady(t_eCU_CIRQS_Ctx* const p_ptCtx, uint8_t* p_puDest, const uint32_t p_uDestL,
+                                     const uint32_t p_uMaxQueueL, t_eCU_CIRQS_Drain* p_ptDrain,
+                                     const uint32_t p_uDrainMaxN, uint32_t* const p_puDrainN)
+{
+	/* Local variable */
+	e_eCU_CIRQS_RES l_eRes;
+    uint32_t l_uWordN;
+    uint32_t l_uStartWord;
+    uint32_t l_uStartBit;
+    uint32_t l_uScanCtr;
+    uint32_t l_uWordIdx;
+    uint32_t l_uReadyBit;
+    uint32_t l_uQueueIdx;
+    uint32_t l_uDestCtr;
+    uint32_t l_uDrainCtr;
+    uint32_t l_uMaxL;
+    uint32_t l_uDrainedL;
+    bool_t l_bStop;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puDest ) || ( NULL == p_ptDrain ) || ( NULL == p_puDrainN ) )
+	{
+		l_eRes = e_eCU_CIRQS_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_CIRQS_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_CIRQS_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_CIRQS_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Check data validity */
+                if( ( p_uDestL <= 0u ) || ( p_uMaxQueueL <= 0u ) || ( p_uDrainMaxN <= 0u ) )
+                {
+                    l_eRes = e_eCU_CIRQS_RES_BADPARAM;
+                }
+                else
+                {
+                    l_eRes = e_eCU_CIRQS_RES_OK;
+                    l_uWordN = ECU_CIRQS_READYMAPL(p_ptCtx->uQueueN);
+                    l_uStartWord = p_ptCtx->uNextQueue / 32u;
+                    l_uStartBit = p_ptCtx->uNextQueue % 32u;
+                    l_uDestCtr = 0u;
+                    l_uDrainCtr = 0u;
+                    l_bStop = false;
+                    l_uScanCtr = 0u;
+
+                    /* Scan the bitmap starting from the next queue to serve. The first word is scanned two times, the
+                     * first time only the bits after the starting queue and at the end only the bits before it */
+                    while( ( l_uScanCtr <= l_uWordN ) && ( false == l_bStop ) && ( e_eCU_CIRQS_RES_OK == l_eRes ) )
+                    {
+                        l_uWordIdx = l_uStartWord + l_uScanCtr;
+                        if( l_uWordIdx >= l_uWordN )
+                        {
+                            l_uWordIdx -= l_uWordN;
+                        }
+
+                        l_uReadyBit = p_ptCtx->puReadyMap[l_uWordIdx];
+                        if( 0u == l_uScanCtr )
+                        {
+                            l_uReadyBit &= ( ( uint32_t ) 0xFFFFFFFFu ) << l_uStartBit;
+                        }
+                        else if( l_uWordN == l_uScanCtr )
+                        {
+                            l_uReadyBit &= ~( ( ( uint32_t ) 0xFFFFFFFFu ) << l_uStartBit );
+                        }
+                        else
+                        {
+                            /* Scan all the word */
+                        }
+
+                        /* Serve every ready queue of this word */
+                        while( ( 0u != l_uReadyBit ) && ( false == l_bStop ) && ( e_eCU_CIRQS_RES_OK == l_eRes ) )
+                        {
+                            if( ( l_uDestCtr >= p_uDestL ) || ( l_uDrainCtr >= p_uDrainMaxN ) )
+                            {
+                                /* No more space where we can drain data */
+                                l_bStop = true;
+                            }
+                            else
+                            {
+                                l_uQueueIdx = ( l_uWordIdx * 32u ) + eCU_CIRQS_GetLowestBit(l_uReadyBit);
+                                l_uReadyBit &= ( l_uReadyBit - 1u );
+
+                                l_uMaxL = p_uDestL - l_uDestCtr;
+                                if( l_uMaxL > p_uMaxQueueL )
+                                {
+                                    l_uMaxL = p_uMaxQueueL;
+                                }
+
+                                l_eRes = eCU_CIRQS_DrainQueue(p_ptCtx, l_uQueueIdx, &p_puDest[l_uDestCtr], l_uMaxL,
+                                                              &l_uDrainedL);
+
+                                if( ( e_eCU_CIRQS_RES_OK == l_eRes ) && ( l_uDrainedL > 0u ) )
+                                {
+                                    p_ptDrain[l_uDrainCtr].uQueueIdx = l_uQueueIdx;
+                                    p_ptDrain[l_uDrainCtr].uDataOffset = l_uDestCtr;
+                                    p_ptDrain[l_uDrainCtr].uDataL = l_uDrainedL;
+                                    l_uDestCtr += l_uDrainedL;
+                                    l_uDrainCtr++;
+
+                                    /* Next call will start from the queue after this one */
+                                    p_ptCtx->uNextQueue = l_uQueueIdx + 1u;
+                                    if( p_ptCtx->uNextQueue >= p_ptCtx->uQueueN )
+                                    {
+                                        p_ptCtx->uNextQueue = 0u;
+                                    }
+                                }
+                            }
+                        }
+
+                        l_uScanCtr++;
+                    }
+
+                    *p_puDrainN = l_uDrainCtr;
+
+                    if( ( e_eCU_CIRQS_RES_OK == l_eRes ) && ( l_uDrainCtr <= 0u ) )
+                    {
+                        l_eRes = e_eCU_CIRQS_RES_EMPTY;
+                    }
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_CIRQS_IsStatusStillCoherent(const t_eCU_CIRQS_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check context validity */
+	if( ( p_ptCtx->uQueueN <= 0u ) || ( NULL == p_ptCtx->ptQueue ) || ( NULL == p_ptCtx->puReadyMap ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Cannot go beyond limits */
+        if( p_ptCtx->uNextQueue >= p_ptCtx->uQueueN )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            l_eRes = true;
+        }
+	}
+
+    return l_eRes;
+}
+
+static e_eCU_CIRQS_RES eCU_CIRQS_ConvertRes(const e_eCU_CIRQ_RES p_eCirqRes)
+{
+    e_eCU_CIRQS_RES l_eRes;
+
+    switch( p_eCirqRes )
+    {
+        case e_eCU_CIRQ_RES_OK:
+        {
+            l_eRes = e_eCU_CIRQS_RES_OK;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_BADPARAM:
+        {
+            l_eRes = e_eCU_CIRQS_RES_BADPARAM;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_BADPOINTER:
+        {
+            l_eRes = e_eCU_CIRQS_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_FULL:
+        {
+            l_eRes = e_eCU_CIRQS_RES_FULL;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_EMPTY:
+        {
+            l_eRes = e_eCU_CIRQS_RES_EMPTY;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_CIRQS_RES_NOINITLIB;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eCU_CIRQS_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eCU_CIRQS_GetLowestBit(const uint32_t p_uWord)
+{
+    /* De Bruijn sequence used to find the index of the lowest bit set in a word without looping over every bit */
+    static const uint8_t l_auDeBruijnIdx[32u] =
+    {
+         0u,  1u, 28u,  2u, 29u, 14u, 24u,  3u, 30u, 22u, 20u, 15u, 25u, 17u,  4u,  8u,
+        31u, 27u, 13u, 23u, 21u, 19u, 16u,  7u, 26u, 12u, 18u,  6u, 11u,  5u, 10u,  9u
+    };
+
+    uint32_t l_uLowestBit;
+
+    /* Isolate the lowest bit set */
+    l_uLowestBit = p_uWord & ( ( ~p_uWord ) + 1u );
+
+    return ( uint32_t ) l_auDeBruijnIdx[ ( uint32_t ) ( l_uLowestBit * 0x077CB531u ) >> 27u ];
+}
+
+static e_eCU_CIRQS_RES eCU_CIRQS_DrainQueue(t_eCU_CIRQS_Ctx* const p_ptCtx, const uint32_t p_uQueueIdx,
+                                            uint8_t* p_puDest, const uint32_t p_uMaxL, uint32_t* const p_puDrainedL)
+{
+    e_eCU_CIRQS_RES l_eRes;
+    uint32_t l_uUsedL;
+
+    *p_puDrainedL = 0u;
+
+    if( p_uQueueIdx >= p_ptCtx->uQueueN )
+    {
+        /* A bit beyond the number of queue is set */
+        l_eRes = e_eCU_CIRQS_RES_CORRUPTCTX;
+    }
+    else
+    {
+        l_eRes = eCU_CIRQS_ConvertRes( eCU_CIRQ_GetOccupiedSapce(&p_ptCtx->ptQueue[p_uQueueIdx], &l_uUsedL) );
+
+        if( e_eCU_CIRQS_RES_OK == l_eRes )
+        {
+            if( l_uUsedL > 0u )
+            {
+                *p_puDrainedL = l_uUsedL;
+                if( *p_puDrainedL > p_uMaxL )
+                {
+                    *p_puDrainedL = p_uMaxL;
+                }
+
+                l_eRes = eCU_CIRQS_ConvertRes( eCU_CIRQ_RetriveData(&p_ptCtx->ptQueue[p_uQueueIdx], p_puDest,
+                                                                    *p_puDrainedL) );
+            }
+
+            if( ( e_eCU_CIRQS_RES_OK == l_eRes ) && ( l_uUsedL <= *p_puDrainedL ) )
+            {
+                /* The queue is empty now, remove it from the ready bitmap */
+                p_ptCtx->puReadyMap[p_uQueueIdx / 32u] &= ~( ( ( uint32_t ) 1u ) << ( p_uQueueIdx % 32u ) );
+            }
+        }
+    }
+
+    return l_eRes;
+}
\ No newline at end of file
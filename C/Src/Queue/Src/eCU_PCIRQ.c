@@ -0,0 +1,576 @@
+/**
+ * @file       eCU_PCIRQ.c
+ *
+ * @brief      Persistent circular queue utils
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_PCIRQ.h"
+#include "eCU_CRC.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINES
+ **********************************************************************************************************************/
+/* Single header copy: sequence number, used space, free index and CRC 32 */
+#define ECU_PCIRQ_SLOTL                                                                         ( ( uint32_t ) 16u )
+
+/* The CRC 32 is calculated on sequence number, used space, free index and queue dimension */
+#define ECU_PCIRQ_CRCDATAL                                                                      ( ( uint32_t ) 16u )
+#define ECU_PCIRQ_CRCOFF                                                                        ( ( uint32_t ) 12u )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_PCIRQ_IsStatusStillCoherent(const t_eCU_PCIRQ_Ctx* p_ptCtx);
+static e_eCU_PCIRQ_RES eCU_PCIRQ_ConvertRes(const e_eCU_CIRQ_RES p_eCirqRes);
+static void eCU_PCIRQ_SaveHeader(t_eCU_PCIRQ_Ctx* const p_ptCtx);
+static bool_t eCU_PCIRQ_LoadHeader(const uint8_t* p_puSlot, const uint32_t p_uBuffL, uint32_t* const p_puSeq,
+                                   uint32_t* const p_puUsedL, uint32_t* const p_puFreeIdx);
+static void eCU_PCIRQ_PutU32(uint8_t* p_puDest, const uint32_t p_uVal);
+static uint32_t eCU_PCIRQ_GetU32(const uint8_t* p_puSrc);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eCU_PCIRQ_RES eCU_PCIRQ_InitCtx(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puMem, const uint32_t p_uMemL)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puMem ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity, we need space for the header and at least one byte of data */
+		if( p_uMemL <= ECU_PCIRQ_HEADERL )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_BADPARAM;
+		}
+		else
+		{
+            /* Init the queue that will manage the data area */
+            l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_InitCtx(&p_ptCtx->tCirq, &p_puMem[ECU_PCIRQ_HEADERL],
+                                                            ( p_uMemL - ECU_PCIRQ_HEADERL ) ) );
+
+            if( e_eCU_PCIRQ_RES_OK == l_eRes )
+            {
+                p_ptCtx->bIsInit = true;
+                p_ptCtx->puMem = p_puMem;
+                p_ptCtx->uSeq = 0u;
+
+                /* Write both the header copies, so an old session can not be recovered anymore */
+                eCU_PCIRQ_SaveHeader(p_ptCtx);
+                eCU_PCIRQ_SaveHeader(p_ptCtx);
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_RecoverCtx(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puMem, const uint32_t p_uMemL)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+    bool_t l_bIsValidA;
+    bool_t l_bIsValidB;
+    uint32_t l_uSeqA;
+    uint32_t l_uSeqB;
+    uint32_t l_uUsedA;
+    uint32_t l_uUsedB;
+    uint32_t l_uFreeA;
+    uint32_t l_uFreeB;
+    uint32_t l_uBuffL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puMem ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( p_uMemL <= ECU_PCIRQ_HEADERL )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_BADPARAM;
+		}
+		else
+		{
+            /* Verify only the two header copies, no need to parse the data area */
+            l_uBuffL = p_uMemL - ECU_PCIRQ_HEADERL;
+            l_bIsValidA = eCU_PCIRQ_LoadHeader(&p_puMem[0u], l_uBuffL, &l_uSeqA, &l_uUsedA, &l_uFreeA);
+            l_bIsValidB = eCU_PCIRQ_LoadHeader(&p_puMem[ECU_PCIRQ_SLOTL], l_uBuffL, &l_uSeqB, &l_uUsedB, &l_uFreeB);
+
+            if( ( true == l_bIsValidA ) && ( true == l_bIsValidB ) )
+            {
+                /* Both valid, select the newest one. Keep in mind that the sequence number can wrap around */
+                if( ( ( l_uSeqB - l_uSeqA ) > 0u ) && ( ( l_uSeqB - l_uSeqA ) < 0x80000000u ) )
+                {
+                    l_bIsValidA = false;
+                }
+                else
+                {
+                    l_bIsValidB = false;
+                }
+            }
+
+            if( ( false == l_bIsValidA ) && ( false == l_bIsValidB ) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_NOVALIDHEADER;
+            }
+            else
+            {
+                l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_InitCtx(&p_ptCtx->tCirq, &p_puMem[ECU_PCIRQ_HEADERL],
+                                                                l_uBuffL) );
+
+                if( e_eCU_PCIRQ_RES_OK == l_eRes )
+                {
+                    p_ptCtx->bIsInit = true;
+                    p_ptCtx->puMem = p_puMem;
+
+                    if( true == l_bIsValidA )
+                    {
+                        p_ptCtx->uSeq = l_uSeqA;
+                        p_ptCtx->tCirq.uBuffUsedL = l_uUsedA;
+                        p_ptCtx->tCirq.uBuffFreeIdx = l_uFreeA;
+                    }
+                    else
+                    {
+                        p_ptCtx->uSeq = l_uSeqB;
+                        p_ptCtx->tCirq.uBuffUsedL = l_uUsedB;
+                        p_ptCtx->tCirq.uBuffFreeIdx = l_uFreeB;
+                    }
+                }
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_IsInit(t_eCU_PCIRQ_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eCU_PCIRQ_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_Reset(t_eCU_PCIRQ_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+            else
+            {
+                l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_Reset(&p_ptCtx->tCirq) );
+
+                if( e_eCU_PCIRQ_RES_OK == l_eRes )
+                {
+                    eCU_PCIRQ_SaveHeader(p_ptCtx);
+                }
+            }
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_GetFreeSapce(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint32_t* const p_puFreeSpace)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFreeSpace ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_GetFreeSapce(&p_ptCtx->tCirq, p_puFreeSpace) );
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_GetOccupiedSapce(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint32_t* const p_puUsedSpace)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puUsedSpace ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_GetOccupiedSapce(&p_ptCtx->tCirq, p_puUsedSpace) );
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_InsertData(t_eCU_PCIRQ_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+                /* Data are copied in the free area, that is not referenced by the saved header */
+				l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_InsertData(&p_ptCtx->tCirq, p_puData, p_uDataL) );
+
+                if( e_eCU_PCIRQ_RES_OK == l_eRes )
+                {
+                    /* Only now the inserted data became part of the persistent queue */
+                    eCU_PCIRQ_SaveHeader(p_ptCtx);
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_RetriveData(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_RetriveData(&p_ptCtx->tCirq, p_puData, p_uDataL) );
+
+                if( e_eCU_PCIRQ_RES_OK == l_eRes )
+                {
+                    eCU_PCIRQ_SaveHeader(p_ptCtx);
+                }
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eCU_PCIRQ_RES eCU_PCIRQ_PeekData(t_eCU_PCIRQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eCU_PCIRQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eCU_PCIRQ_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eCU_PCIRQ_ConvertRes( eCU_CIRQ_PeekData(&p_ptCtx->tCirq, p_puData, p_uDataL) );
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eCU_PCIRQ_IsStatusStillCoherent(const t_eCU_PCIRQ_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check context validity */
+	if( NULL == p_ptCtx->puMem )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		/* The data area must be placed right after the header */
+		if( &p_ptCtx->puMem[ECU_PCIRQ_HEADERL] != p_ptCtx->tCirq.puBuff )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+            l_eRes = true;
+		}
+	}
+
+    return l_eRes;
+}
+
+static e_eCU_PCIRQ_RES eCU_PCIRQ_ConvertRes(const e_eCU_CIRQ_RES p_eCirqRes)
+{
+    e_eCU_PCIRQ_RES l_eRes;
+
+    switch( p_eCirqRes )
+    {
+        case e_eCU_CIRQ_RES_OK:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_OK;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_BADPARAM:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_BADPARAM;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_BADPOINTER:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_FULL:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_FULL;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_EMPTY:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_EMPTY;
+            break;
+        }
+
+        case e_eCU_CIRQ_RES_NOINITLIB:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_NOINITLIB;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eCU_PCIRQ_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eCU_PCIRQ_SaveHeader(t_eCU_PCIRQ_Ctx* const p_ptCtx)
+{
+    uint8_t l_auHeader[ECU_PCIRQ_CRCDATAL];
+    uint8_t* l_puSlot;
+    uint32_t l_uCrc;
+
+    /* Every header write use the other copy, leaving the last valid one untouched */
+    p_ptCtx->uSeq++;
+    l_puSlot = &p_ptCtx->puMem[ ( p_ptCtx->uSeq & 1u ) * ECU_PCIRQ_SLOTL ];
+
+    eCU_PCIRQ_PutU32(&l_auHeader[0u], p_ptCtx->uSeq);
+    eCU_PCIRQ_PutU32(&l_auHeader[4u], p_ptCtx->tCirq.uBuffUsedL);
+    eCU_PCIRQ_PutU32(&l_auHeader[8u], p_ptCtx->tCirq.uBuffFreeIdx);
+    eCU_PCIRQ_PutU32(&l_auHeader[12u], p_ptCtx->tCirq.uBuffL);
+
+    l_uCrc = 0u;
+    (void)eCU_CRC_32(l_auHeader, ECU_PCIRQ_CRCDATAL, &l_uCrc);
+
+    /* The data of the queue must be in memory before the header that describe it, and the header must be in memory
+     * before the next data write that could reuse the space it has just freed */
+    ECU_PCIRQ_MEMBARRIER();
+
+    /* The queue dimension is not saved, it must be passed again during the recovery */
+    (void)memcpy(l_puSlot, l_auHeader, ECU_PCIRQ_CRCOFF);
+    eCU_PCIRQ_PutU32(&l_puSlot[ECU_PCIRQ_CRCOFF], l_uCrc);
+
+    ECU_PCIRQ_MEMBARRIER();
+}
+
+static bool_t eCU_PCIRQ_LoadHeader(const uint8_t* p_puSlot, const uint32_t p_uBuffL, uint32_t* const p_puSeq,
+                                   uint32_t* const p_puUsedL, uint32_t* const p_puFreeIdx)
+{
+    bool_t l_bRes;
+    uint8_t l_auHeader[ECU_PCIRQ_CRCDATAL];
+    uint32_t l_uCrc;
+
+    (void)memcpy(l_auHeader, p_puSlot, ECU_PCIRQ_CRCOFF);
+    eCU_PCIRQ_PutU32(&l_auHeader[12u], p_uBuffL);
+
+    if( e_eCU_CRC_RES_OK != eCU_CRC_32(l_auHeader, ECU_PCIRQ_CRCDATAL, &l_uCrc) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        /* Check integrity of the header */
+        if( eCU_PCIRQ_GetU32(&p_puSlot[ECU_PCIRQ_CRCOFF]) != l_uCrc )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            *p_puSeq = eCU_PCIRQ_GetU32(&l_auHeader[0u]);
+            *p_puUsedL = eCU_PCIRQ_GetU32(&l_auHeader[4u]);
+            *p_puFreeIdx = eCU_PCIRQ_GetU32(&l_auHeader[8u]);
+
+            /* Check index limits */
+            if( ( *p_puUsedL > p_uBuffL ) || ( *p_puFreeIdx >= p_uBuffL ) )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                l_bRes = true;
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static void eCU_PCIRQ_PutU32(uint8_t* p_puDest, const uint32_t p_uVal)
+{
+    p_puDest[0u] = (uint8_t) ( ( p_uVal        ) & 0x000000FFu );
+    p_puDest[1u] = (uint8_t) ( ( p_uVal >> 8u  ) & 0x000000FFu );
+    p_puDest[2u] = (uint8_t) ( ( p_uVal >> 16u ) & 0x000000FFu );
+    p_puDest[3u] = (uint8_t) ( ( p_uVal >> 24u ) & 0x000000FFu );
+}
+
+static uint32_t eCU_PCIRQ_GetU32(const uint8_t* p_puSrc)
+{
+    uint32_t l_uVal;
+
+    l_uVal  = ( (uint32_t) p_puSrc[0u] );
+    l_uVal |= ( (uint32_t) p_puSrc[1u] ) << 8u;
+    l_uVal |= ( (uint32_t) p_puSrc[2u] ) << 16u;
+    l_uVal |= ( (uint32_t) p_puSrc[3u] ) << 24u;
+
+    return l_uVal;
+}
\ No newline at end of file
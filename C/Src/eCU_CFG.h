@@ -0,0 +1,52 @@
+/**
+ * @file       eCU_CFG.h
+ *
+ * @brief      Ecu lib build configuration header
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CFG_H
+#define ECU_CFG_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Option that change the layout of a public struct. They are selected only here, so the library and every module
+ * that use it always see the same struct. Comment an option and rebuild both the library and the application in
+ * order to disable it. */
+
+/* Enable the circular queue statistics, see eCU_CIRQ_GetStats. It add the tStats field to t_eCU_CIRQ_Ctx. */
+#ifndef ECU_CIRQ_ENABLESTATS
+    #define ECU_CIRQ_ENABLESTATS
+#endif
+
+/* Barrier used by the persistent circular queue between a data write and the header write that commit it, see
+ * eCU_PCIRQ.h. The default one only stop the compiler from moving memory access across it. On a core that can
+ * reorder or buffer the store ( e.g. Cortex-M7 ) define it as a hardware barrier, like the CMSIS __DMB(). */
+#ifndef ECU_PCIRQ_MEMBARRIER
+    #if defined( __GNUC__ ) || defined( __clang__ ) || defined( __ICCARM__ )
+        #define ECU_PCIRQ_MEMBARRIER()                          __asm volatile ( "" : : : "memory" )
+    #else
+        #error "Define ECU_PCIRQ_MEMBARRIER() with the compiler barrier of the used toolchain"
+    #endif
+#endif
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CFG_H */
\ No newline at end of file
@@ -62,6 +62,19 @@ extern "C" {
   #define MIN_UINT8VAL                                                                             ( ( uint8_t ) 0x00u )
 #endif
 
+/* Define ECU_TRUSTED_FASTPATH in the compiler options in order to skip the pointer, init and context coherence checks
+ * of the functions called for every single element or chunk (push, pop, insert, retrive, peek and digest). Init and
+ * frame boundary functions keep every check. Defining ECU_DEBUG too will keep every check anyway, so debug builds and
+ * tests can still detect a misuse. */
+/* #define ECU_TRUSTED_FASTPATH */
+
+/* Wrap a check that can be skipped in the trusted fast path, the skipped branch is removed by the compiler */
+#if defined( ECU_TRUSTED_FASTPATH ) && !defined( ECU_DEBUG )
+  #define ECU_HOTCHK( cond )                                                                                   ( false )
+#else
+  #define ECU_HOTCHK( cond )                                                                                    ( cond )
+#endif
+
 
 
 #ifdef __cplusplus
@@ -22,6 +22,7 @@ extern "C" {
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eCU_STANDARDTYPE.h"
+#include "eCU_CFG.h"
 
 
 
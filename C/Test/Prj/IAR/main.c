@@ -1,12 +1,19 @@
 #include "eCU_CRCTST.h"
 #include "eCU_CRCDTST.h"
 #include "eCU_CIRQTST.h"
+#include "eCU_PCIRQTST.h"
+#include "eCU_CIRQSTST.h"
 #include "eCU_DPKTST.h"
 #include "eCU_DUNPKTST.h"
 #include "eCU_DPKDUNPKTST.h"
 #include "eCU_BSTFTST.h"
 #include "eCU_BUSTFTST.h"
 #include "eCU_BSTFBUNSTFTST.h"
+#include "eCU_CSTFTST.h"
+#include "eCU_CUSTFTST.h"
+#include "eCU_BSTFCFGTST.h"
+#include "eCU_BUNSTFMCTST.h"
+#include "eCU_DSCHTST.h"
 
 int main(void);
 
@@ -17,12 +24,19 @@ int main(void)
     eCU_CRCTST_ExeTest();
     eCU_CRCDTST_ExeTest();
     eCU_CIRQTST_ExeTest();
+    eCU_PCIRQTST_ExeTest();
+    eCU_CIRQSTST_ExeTest();
     eCU_DPKTST_ExeTest();
     eCU_DUNPKTST_ExeTest();
 	eCU_DPKDUNPKTST_ExeTest();
     eCU_BSTFTST_ExeTest();
     eCU_BUSTFTST_ExeTest();
     eCU_BSTFBUNSTFTST_ExeTest();
+    eCU_CSTFTST_ExeTest();
+    eCU_CUSTFTST_ExeTest();
+    eCU_BSTFCFGTST_ExeTest();
+    eCU_BUNSTFMCTST_ExeTest();
+    eCU_DSCHTST_ExeTest();
 
     return 0;
 }
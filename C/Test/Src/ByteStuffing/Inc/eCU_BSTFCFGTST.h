@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_BSTFCFGTST.h
+ *
+ * @brief      Byte stuffer delimiter configuration test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_BSTFCFGTST_H
+#define ECU_BSTFCFGTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the byte stuffer delimiter configuration module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_BSTFCFGTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_BSTFCFGTST_H */
\ No newline at end of file
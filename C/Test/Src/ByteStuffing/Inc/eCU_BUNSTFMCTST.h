@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_BUNSTFMCTST.h
+ *
+ * @brief      Multi channel byte unstuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_BUNSTFMCTST_H
+#define ECU_BUNSTFMCTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the multi channel byte unstuffer module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_BUNSTFMCTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_BUNSTFMCTST_H */
\ No newline at end of file
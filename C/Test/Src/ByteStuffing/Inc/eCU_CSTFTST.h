@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_CSTFTST.h
+ *
+ * @brief      COBS byte stuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CSTFTST_H
+#define ECU_CSTFTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the COBS byte stuffer module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_CSTFTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CSTFTST_H */
\ No newline at end of file
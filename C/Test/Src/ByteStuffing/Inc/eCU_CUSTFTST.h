@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_CUSTFTST.h
+ *
+ * @brief      COBS byte unstuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CUSTFTST_H
+#define ECU_CUSTFTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the COBS byte unstuffer module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_CUSTFTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CUSTFTST_H */
\ No newline at end of file
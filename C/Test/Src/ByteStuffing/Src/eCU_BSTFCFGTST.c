@@ -0,0 +1,583 @@
+/**
+ * @file       eCU_BSTFCFGTST.c
+ *
+ * @brief      Byte stuffer delimiter configuration test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_BSTFCFGTST.h"
+#include "eCU_BSTFCFG.h"
+#include "eCU_BSTF.h"
+#include "eCU_BUNSTF.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_BSTFCFGTST_BadPointer(void);
+static void eCU_BSTFCFGTST_BadInit(void);
+static void eCU_BSTFCFGTST_BadParamEntr(void);
+static void eCU_BSTFCFGTST_KnownVector(void);
+static void eCU_BSTFCFGTST_UnstufVector(void);
+static void eCU_BSTFCFGTST_RoundTrip(void);
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_BSTFCFGTST_ExeTest(void)
+{
+	(void)printf("\n\nBYTE STUFFER CONFIGURATION TEST START \n\n");
+
+    eCU_BSTFCFGTST_BadPointer();
+    eCU_BSTFCFGTST_BadInit();
+    eCU_BSTFCFGTST_BadParamEntr();
+    eCU_BSTFCFGTST_KnownVector();
+    eCU_BSTFCFGTST_UnstufVector();
+    eCU_BSTFCFGTST_RoundTrip();
+
+    (void)printf("\n\nBYTE STUFFER CONFIGURATION TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_BSTFCFGTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BSTF_Ctx l_tStf;
+    t_eCU_BUNSTF_Ctx l_tUnstf;
+    uint8_t  l_auMemArea[5u];
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_InitCtx(NULL, ECU_SOF, ECU_EOF, ECU_ESC, 0xFFu) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_InitHdlc(NULL) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_InitSlip(NULL) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_IsInit(&l_tCfg, NULL) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_BADPOINTER == eCU_BSTFCFG_AddStuffByte(NULL, 0x03u) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_SetCfg(NULL, &l_tCfg) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tStf, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_SetCfg(&l_tStf, NULL) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SetCfg(NULL, &l_tCfg) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InitCtx(&l_tUnstf, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SetCfg(&l_tUnstf, NULL) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadPointer 10 -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFCFGTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BSTF_Ctx l_tStf;
+    t_eCU_BUNSTF_Ctx l_tUnstf;
+    uint8_t  l_auMemArea[5u];
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCfg.bIsInit = false;
+    l_tStf.bIsInit = false;
+    l_tUnstf.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_IsInit(&l_tCfg, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTFCFG_RES_NOINITLIB == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x03u) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_SetCfg(&l_tStf, &l_tCfg) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 4  -- FAIL \n");
+    }
+
+    /* Function, a configuration not initialized can't be used */
+    (void)eCU_BSTF_InitCtx(&l_tStf, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_BUNSTF_InitCtx(&l_tUnstf, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_SetCfg(&l_tStf, &l_tCfg) ) &&
+        ( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 5  -- FAIL \n");
+    }
+
+    /* Function, a configuration deinitialized after being used corrupt the context */
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg);
+    l_tCfg.bIsInit = false;
+    if( ( e_eCU_BSTF_RES_CORRUPTCTX == eCU_BSTF_NewFrame(&l_tStf, 1u) ) &&
+        ( e_eCU_BUNSTF_RES_CORRUPTCTX == eCU_BUNSTF_NewFrame(&l_tUnstf) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadInit 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFCFGTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+
+    /* Function, eSC equal to SOF */
+    if( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_InitCtx(&l_tCfg, 0x10u, 0x11u, 0x10u, 0xFFu) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* Function, eSC equal to EOF */
+    if( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_InitCtx(&l_tCfg, 0x10u, 0x11u, 0x11u, 0xFFu) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    /* Function, mask that doesn't transform */
+    if( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_InitCtx(&l_tCfg, 0x10u, 0x11u, 0x12u, 0x00u) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* Function, the transformed SOF is the EOF */
+    if( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_InitCtx(&l_tCfg, 0x10u, 0x30u, 0x12u, 0x20u) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* Function, sLIP doesn't have a xor transformation */
+    if( ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_InitSlip(&l_tCfg) ) &&
+        ( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x03u) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    /* Function, transformed in the HDLC flag, or transformation of the HDLC escape */
+    if( ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_InitHdlc(&l_tCfg) ) &&
+        ( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x5Eu) ) &&
+        ( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x5Du) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    /* Function, control character and already stuffed byte */
+    if( ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x03u) ) &&
+        ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x03u) ) &&
+        ( e_eCU_BSTFCFG_RES_OK == eCU_BSTFCFG_AddStuffByte(&l_tCfg, ECU_BSTFCFG_HDLC_FLAG) ) &&
+        ( e_eCU_BSTFCFG_RES_BADPARAM == eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x23u) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_BadParamEntr 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFCFGTST_KnownVector(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BSTF_Ctx l_tStf;
+    uint8_t  l_auStuffed[20u];
+    uint32_t l_uRemL;
+    uint32_t l_uVarTemp32;
+    uint8_t  l_auHdlc[] = { 0x11u, 0x7Eu, 0x22u, 0x7Du, 0x03u };
+    uint8_t  l_auHdlcStf[] = { 0x7Eu, 0x11u, 0x7Du, 0x5Eu, 0x22u, 0x7Du, 0x5Du, 0x03u, 0x7Eu };
+    uint8_t  l_auHdlcAccmStf[] = { 0x7Eu, 0x11u, 0x7Du, 0x5Eu, 0x22u, 0x7Du, 0x5Du, 0x7Du, 0x23u, 0x7Eu };
+    uint8_t  l_auSlip[] = { 0x11u, 0xC0u, 0xDBu, 0x22u };
+    uint8_t  l_auSlipStf[] = { 0xC0u, 0x11u, 0xDBu, 0xDCu, 0xDBu, 0xDDu, 0x22u, 0xC0u };
+
+    /* Init variable */
+    (void)eCU_BSTF_InitCtx(&l_tStf, l_auStuffed, sizeof(l_auStuffed));
+
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    /* Function, HDLC */
+    (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tStf, l_auHdlc, sizeof(l_auHdlc)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetRemByteToGet(&l_tStf, &l_uRemL) ) && ( sizeof(l_auHdlcStf) == l_uRemL ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tStf, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auHdlcStf) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auHdlcStf, sizeof(l_auHdlcStf)) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 1  -- FAIL \n");
+    }
+
+    (void)eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x03u);
+    /* Function, HDLC with a control character escaped */
+    (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tStf, l_auHdlc, sizeof(l_auHdlc)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetRemByteToGet(&l_tStf, &l_uRemL) ) && ( sizeof(l_auHdlcAccmStf) == l_uRemL ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tStf, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auHdlcAccmStf) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auHdlcAccmStf, sizeof(l_auHdlcAccmStf)) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 2  -- FAIL \n");
+    }
+
+    (void)eCU_BSTFCFG_InitSlip(&l_tCfg);
+    /* Function, SLIP */
+    (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tStf, l_auSlip, sizeof(l_auSlip)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetRemByteToGet(&l_tStf, &l_uRemL) ) && ( sizeof(l_auSlipStf) == l_uRemL ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tStf, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auSlipStf) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auSlipStf, sizeof(l_auSlipStf)) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_KnownVector 3  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFCFGTST_UnstufVector(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BUNSTF_Ctx l_tUnstf;
+    uint8_t  l_auMemArea[20u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uVarTemp32;
+    uint8_t  l_auHdlc[] = { 0x11u, 0x7Eu, 0x22u, 0x7Du, 0x03u };
+    uint8_t  l_auHdlcStf[] = { 0x7Eu, 0x11u, 0x7Du, 0x5Eu, 0x22u, 0x7Du, 0x5Du, 0x03u, 0x7Eu };
+    uint8_t  l_auSlip[] = { 0x11u, 0xC0u, 0xDBu, 0x22u };
+    uint8_t  l_auSlipStf[] = { 0xC0u, 0x11u, 0xDBu, 0xDCu, 0xDBu, 0xDDu, 0x22u, 0xC0u };
+    uint8_t  l_auDoubleFlag[] = { 0x7Eu, 0x7Eu, 0x7Eu, 0x11u, 0x22u, 0x7Eu };
+    uint8_t  l_auAnyEsc[] = { 0x7Eu, 0x11u, 0x7Du, 0x31u, 0x7Du, 0x01u, 0x7Eu };
+    uint8_t  l_auBadEsc[] = { 0x7Eu, 0x11u, 0x7Du, 0x7Du, 0x7Eu };
+    uint8_t  l_auNotStf[] = { 0xC0u, 0x11u, 0xA1u, 0xA2u, 0xA3u, 0xC0u };
+
+    /* Init variable */
+    (void)eCU_BUNSTF_InitCtx(&l_tUnstf, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg);
+
+    /* Function, HDLC */
+    (void)eCU_BUNSTF_NewFrame(&l_tUnstf);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auHdlcStf, sizeof(l_auHdlcStf),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auHdlcStf) == l_uVarTemp32 ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) &&
+        ( sizeof(l_auHdlc) == l_uDataL ) && ( 0 == memcmp(l_puData, l_auHdlc, sizeof(l_auHdlc)) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 1  -- FAIL \n");
+    }
+
+    /* Function, consecutive flag are not an empty frame */
+    (void)eCU_BUNSTF_NewFrame(&l_tUnstf);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auDoubleFlag, sizeof(l_auDoubleFlag),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auDoubleFlag) == l_uVarTemp32 ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) &&
+        ( 2u == l_uDataL ) && ( 0x11u == l_puData[0u] ) && ( 0x22u == l_puData[1u] ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 2  -- FAIL \n");
+    }
+
+    /* Function, RFC 1662 every byte after the escape is xored, even if not stuffed. Escape after escape is an error */
+    (void)eCU_BUNSTF_NewFrame(&l_tUnstf);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auAnyEsc, sizeof(l_auAnyEsc),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auAnyEsc) == l_uVarTemp32 ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) &&
+        ( 3u == l_uDataL ) && ( 0x11u == l_puData[0u] ) && ( 0x11u == l_puData[1u] ) && ( 0x21u == l_puData[2u] ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tUnstf) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auBadEsc, sizeof(l_auBadEsc),
+                                                               &l_uVarTemp32) ) && ( 4u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 3  -- FAIL \n");
+    }
+
+    /* Function, SLIP, old delimiter are raw data now */
+    (void)eCU_BSTFCFG_InitSlip(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auSlipStf, sizeof(l_auSlipStf),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auSlipStf) == l_uVarTemp32 ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) &&
+        ( sizeof(l_auSlip) == l_uDataL ) && ( 0 == memcmp(l_puData, l_auSlip, sizeof(l_auSlip)) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 4  -- FAIL \n");
+    }
+
+    /* Function, default delimiter */
+    (void)eCU_BUNSTF_NewFrame(&l_tUnstf);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tUnstf, l_auNotStf, sizeof(l_auNotStf),
+                                                                 &l_uVarTemp32) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) &&
+        ( 4u == l_uDataL ) && ( 0 == memcmp(l_puData, &l_auNotStf[1u], 4u) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_UnstufVector 5  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFCFGTST_RoundTrip(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BSTF_Ctx l_tStf;
+    t_eCU_BUNSTF_Ctx l_tUnstf;
+    uint8_t  l_auPayload[512u];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(512u)];
+    uint8_t  l_auStuffedDef[ECU_BSTF_MAXSTUFFL(512u)];
+    uint8_t  l_auMemArea[512u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uStuffedL;
+    uint32_t l_uStuffedDefL;
+    uint32_t l_uRemL;
+    uint32_t l_uIdx;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uCfgIdx;
+    bool_t   l_bIsOk;
+
+    /* Init variable, every byte value is present */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        l_auPayload[l_uIdx] = (uint8_t)( ( l_uIdx * 7u ) + ( l_uIdx >> 8u ) );
+    }
+
+    /* Function, a custom configuration equal to the default one generate the same frame */
+    (void)eCU_BSTF_InitCtx(&l_tStf, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_BSTF_NewFrameExt(&l_tStf, l_auPayload, sizeof(l_auPayload));
+    (void)eCU_BSTF_GetStufChunk(&l_tStf, l_auStuffedDef, sizeof(l_auStuffedDef), &l_uStuffedDefL);
+    (void)eCU_BSTFCFG_InitCtx(&l_tCfg, ECU_SOF, ECU_EOF, ECU_ESC, 0xFFu);
+    (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tStf, l_auPayload, sizeof(l_auPayload)) ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tStf, l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL) ) &&
+        ( l_uStuffedL == l_uStuffedDefL ) && ( 0 == memcmp(l_auStuffed, l_auStuffedDef, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFCFGTST_RoundTrip 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_RoundTrip 1  -- FAIL \n");
+    }
+
+    /* Function, stuff and unstuff with every configuration, in chunk of different size */
+    l_bIsOk = true;
+    for( l_uCfgIdx = 0u; l_uCfgIdx < 3u; l_uCfgIdx++ )
+    {
+        if( 0u == l_uCfgIdx )
+        {
+            (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+            (void)eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x00u);
+            (void)eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x11u);
+            (void)eCU_BSTFCFG_AddStuffByte(&l_tCfg, 0x13u);
+        }
+        else if( 1u == l_uCfgIdx )
+        {
+            (void)eCU_BSTFCFG_InitSlip(&l_tCfg);
+        }
+        else
+        {
+            (void)eCU_BSTFCFG_InitCtx(&l_tCfg, 0x02u, 0x03u, 0x10u, 0x80u);
+        }
+
+        (void)eCU_BSTF_SetCfg(&l_tStf, &l_tCfg);
+        (void)eCU_BSTF_NewFrameExt(&l_tStf, l_auPayload, sizeof(l_auPayload));
+        (void)eCU_BSTF_GetRemByteToGet(&l_tStf, &l_uRemL);
+
+        l_uStuffedL = 0u;
+        while( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunk(&l_tStf, &l_auStuffed[l_uStuffedL], 13u, &l_uVarTemp32) )
+        {
+            l_uStuffedL += l_uVarTemp32;
+        }
+        l_uStuffedL += l_uVarTemp32;
+
+        (void)eCU_BUNSTF_InitCtx(&l_tUnstf, l_auMemArea, sizeof(l_auMemArea));
+        (void)eCU_BUNSTF_SetCfg(&l_tUnstf, &l_tCfg);
+        l_uIdx = 0u;
+        while( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunk(&l_tUnstf, &l_auStuffed[l_uIdx], 7u, &l_uVarTemp32) )
+        {
+            l_uIdx += l_uVarTemp32;
+        }
+        l_uIdx += l_uVarTemp32;
+
+        if( ( l_uRemL != l_uStuffedL ) || ( l_uIdx != l_uStuffedL ) ||
+            ( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_GetUnstufData(&l_tUnstf, &l_puData, &l_uDataL) ) ||
+            ( sizeof(l_auPayload) != l_uDataL ) || ( 0 != memcmp(l_puData, l_auPayload, l_uDataL) ) ||
+            ( NULL != memchr(&l_auStuffed[1u], l_tCfg.uEof, l_uStuffedL - 2u) ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+    if( true == l_bIsOk )
+    {
+        (void)printf("eCU_BSTFCFGTST_RoundTrip 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFCFGTST_RoundTrip 2  -- FAIL \n");
+    }
+}
\ No newline at end of file
@@ -12,6 +12,7 @@
  **********************************************************************************************************************/
 #include "eCU_BSTFTST.h"
 #include "eCU_BSTF.h"
+#include "eCU_CRC.h"
 #include <stdio.h>
 
 #ifdef __IAR_SYSTEMS_ICC__
@@ -35,6 +36,13 @@ static void eCU_BSTFTST_GetRemainings(void);
 static void eCU_BSTFTST_General(void);
 static void eCU_BSTFTST_GeneralAnother(void);
 static void eCU_BSTFTST_Correcteness(void);
+static void eCU_BSTFTST_LongRun(void);
+static void eCU_BSTFTST_OneShot(void);
+static void eCU_BSTFTST_ExtFrame(void);
+static void eCU_BSTFTST_SegFrame(void);
+static void eCU_BSTFTST_CrcMode(void);
+static void eCU_BSTFTST_CirqOut(void);
+static void eCU_BSTFTST_StuffBatch(void);
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
@@ -54,6 +62,13 @@ void eCU_BSTFTST_ExeTest(void)
     eCU_BSTFTST_General();
     eCU_BSTFTST_GeneralAnother();
     eCU_BSTFTST_Correcteness();
+    eCU_BSTFTST_LongRun();
+    eCU_BSTFTST_OneShot();
+    eCU_BSTFTST_ExtFrame();
+    eCU_BSTFTST_SegFrame();
+    eCU_BSTFTST_CrcMode();
+    eCU_BSTFTST_CirqOut();
+    eCU_BSTFTST_StuffBatch();
 
     (void)printf("\n\nBYTE STUFFER TEST END \n\n");
 }
@@ -3141,4 +3156,934 @@ static void eCU_BSTFTST_Correcteness(void)
 
 #ifdef __IAR_SYSTEMS_ICC__
     #pragma cstat_restore = "CERT-STR32-C"
-#endif
\ No newline at end of file
+#endif
+
+static void eCU_BSTFTST_LongRun(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auMemAreaExpected[602u];
+    uint8_t  l_auMemAreaFinalChunk[602u];
+    uint32_t l_uExpectedL;
+    uint32_t l_uFilledL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uChunkL;
+    uint32_t l_uIdx;
+    e_eCU_BSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Init variable, long run of raw data with some special byte in every position of a word */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMemArea); l_uIdx++ )
+    {
+        l_auMemArea[l_uIdx] = (uint8_t)( l_uIdx * 7u );
+    }
+    l_auMemArea[0u] = ECU_SOF;
+    l_auMemArea[37u] = ECU_EOF;
+    l_auMemArea[38u] = ECU_ESC;
+    l_auMemArea[102u] = ECU_SOF;
+    l_auMemArea[199u] = ECU_ESC;
+    l_auMemArea[299u] = ECU_EOF;
+
+    l_uExpectedL = 0u;
+    l_auMemAreaExpected[l_uExpectedL] = ECU_SOF;
+    l_uExpectedL++;
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMemArea); l_uIdx++ )
+    {
+        if( ( ECU_SOF == l_auMemArea[l_uIdx] ) || ( ECU_EOF == l_auMemArea[l_uIdx] ) ||
+            ( ECU_ESC == l_auMemArea[l_uIdx] ) )
+        {
+            l_auMemAreaExpected[l_uExpectedL] = ECU_ESC;
+            l_uExpectedL++;
+            l_auMemAreaExpected[l_uExpectedL] = (uint8_t)~l_auMemArea[l_uIdx];
+            l_uExpectedL++;
+        }
+        else
+        {
+            l_auMemAreaExpected[l_uExpectedL] = l_auMemArea[l_uIdx];
+            l_uExpectedL++;
+        }
+    }
+    l_auMemAreaExpected[l_uExpectedL] = ECU_EOF;
+    l_uExpectedL++;
+
+    /* Function */
+    l_bTestOk = true;
+    if( e_eCU_BSTF_RES_OK != eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        l_bTestOk = false;
+    }
+
+    for( l_uChunkL = 1u; ( l_uChunkL <= 17u ) && ( true == l_bTestOk ); l_uChunkL++ )
+    {
+        (void)memset(l_auMemAreaFinalChunk, 0, sizeof(l_auMemAreaFinalChunk));
+        l_uFilledL = 0u;
+
+        if( e_eCU_BSTF_RES_OK != eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) )
+        {
+            l_bTestOk = false;
+        }
+
+        do
+        {
+            l_eRes = eCU_BSTF_GetStufChunk(&l_tCtx, &l_auMemAreaFinalChunk[l_uFilledL], l_uChunkL, &l_uVarTemp32);
+            if( ( e_eCU_BSTF_RES_OK == l_eRes ) && ( l_uChunkL != l_uVarTemp32 ) )
+            {
+                l_bTestOk = false;
+            }
+            l_uFilledL += l_uVarTemp32;
+        }
+        while( ( e_eCU_BSTF_RES_OK == l_eRes ) && ( ( l_uFilledL + l_uChunkL ) <= sizeof(l_auMemAreaFinalChunk) ) );
+
+        if( ( e_eCU_BSTF_RES_FRAMEENDED != l_eRes ) || ( l_uExpectedL != l_uFilledL ) ||
+            ( 0 != memcmp(l_auMemAreaExpected, l_auMemAreaFinalChunk, l_uExpectedL) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_BSTFTST_LongRun 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_LongRun 1  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_OneShot(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(40u)];
+    uint8_t  l_auStuffedChunk[ECU_BSTF_MAXSTUFFL(40u)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uIdx;
+
+    /* Init variable */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMemArea); l_uIdx++ )
+    {
+        l_auMemArea[l_uIdx] = (uint8_t)( l_uIdx * 13u );
+    }
+    l_auMemArea[3u] = ECU_SOF;
+    l_auMemArea[4u] = ECU_EOF;
+    l_auMemArea[20u] = ECU_ESC;
+    l_auMemArea[39u] = ECU_SOF;
+
+    /* Function */
+    if( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBuf(NULL, sizeof(l_auMemArea), l_auStuffed, sizeof(l_auStuffed),
+                                                       &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_OneShot 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_StuffBuf(l_auMemArea, 0u, l_auStuffed, sizeof(l_auStuffed),
+                                                     &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_OneShot 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 2  -- FAIL \n");
+    }
+
+    /* Function, the one shot stuffer must produce the same frame of the chunked one */
+    (void)memset(l_auStuffed, 0, sizeof(l_auStuffed));
+    (void)memset(l_auStuffedChunk, 0, sizeof(l_auStuffedChunk));
+    if( e_eCU_BSTF_RES_OK == eCU_BSTF_StuffBuf(l_auMemArea, sizeof(l_auMemArea), l_auStuffed, sizeof(l_auStuffed),
+                                               &l_uStuffedL) )
+    {
+        if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+            ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+            ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk,
+                                                                 sizeof(l_auStuffedChunk), &l_uVarTemp32) ) &&
+            ( 46u == l_uStuffedL ) && ( l_uVarTemp32 == l_uStuffedL ) &&
+            ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+        {
+            (void)printf("eCU_BSTFTST_OneShot 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BSTFTST_OneShot 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 3  -- FAIL \n");
+    }
+
+    /* Function, exact dimension is enough */
+    if( e_eCU_BSTF_RES_OK == eCU_BSTF_StuffBuf(l_auMemArea, sizeof(l_auMemArea), l_auStuffed, 46u, &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_OneShot 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 4  -- FAIL \n");
+    }
+
+    /* Function, one byte less for EOF, for an escaped byte and for raw data */
+    if( ( e_eCU_BSTF_RES_OUTOFMEM == eCU_BSTF_StuffBuf(l_auMemArea, sizeof(l_auMemArea), l_auStuffed, 45u,
+                                                       &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_OUTOFMEM == eCU_BSTF_StuffBuf(l_auMemArea, 5u, l_auStuffed, 8u, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_OUTOFMEM == eCU_BSTF_StuffBuf(l_auMemArea, 3u, l_auStuffed, 4u, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_OUTOFMEM == eCU_BSTF_StuffBuf(l_auMemArea, 1u, l_auStuffed, 2u, &l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_OneShot 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 5  -- FAIL \n");
+    }
+
+    /* Function, worst case */
+    (void)memset(l_auMemArea, ECU_ESC, sizeof(l_auMemArea));
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_StuffBuf(l_auMemArea, sizeof(l_auMemArea), l_auStuffed, sizeof(l_auStuffed),
+                                                 &l_uStuffedL) ) &&
+        ( ECU_BSTF_MAXSTUFFL(40u) == l_uStuffedL ) && ( ECU_SOF == l_auStuffed[0u] ) &&
+        ( ECU_ESC == l_auStuffed[1u] ) && ( ( (uint8_t)~ECU_ESC ) == l_auStuffed[2u] ) &&
+        ( ECU_EOF == l_auStuffed[l_uStuffedL - 1u] ) )
+    {
+        (void)printf("eCU_BSTFTST_OneShot 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_OneShot 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_ExtFrame(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auExtFrame[30u];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(30u)];
+    uint8_t  l_auStuffedChunk[ECU_BSTF_MAXSTUFFL(30u)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uFilledL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uIdx;
+    e_eCU_BSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Init variable, external frame bigger than the context buffer */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auExtFrame); l_uIdx++ )
+    {
+        l_auExtFrame[l_uIdx] = (uint8_t)( l_uIdx * 3u );
+    }
+    l_auExtFrame[2u] = ECU_ESC;
+    l_auExtFrame[29u] = ECU_SOF;
+    (void)eCU_BSTF_StuffBuf(l_auExtFrame, sizeof(l_auExtFrame), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_NewFrameExt(NULL, l_auExtFrame, sizeof(l_auExtFrame)) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_NewFrameExt(&l_tCtx, NULL, sizeof(l_auExtFrame)) ) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 1  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_NewFrameExt(&l_tCtx, l_auExtFrame, sizeof(l_auExtFrame)) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_NewFrameExt(&l_tCtx, l_auExtFrame, 0u) ) &&
+        ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auExtFrame)) ) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 3  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tCtx, l_auExtFrame, sizeof(l_auExtFrame)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) ) &&
+        ( l_uStuffedL == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 4  -- FAIL \n");
+    }
+
+    /* Function, stuff directly from the external frame, restarting one time in the middle */
+    l_bTestOk = true;
+    l_uFilledL = 0u;
+    (void)memset(l_auStuffedChunk, 0, sizeof(l_auStuffedChunk));
+    if( e_eCU_BSTF_RES_OK != eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, 7u, &l_uVarTemp32) )
+    {
+        l_bTestOk = false;
+    }
+
+    if( e_eCU_BSTF_RES_OK != eCU_BSTF_RestartFrame(&l_tCtx) )
+    {
+        l_bTestOk = false;
+    }
+
+    do
+    {
+        l_eRes = eCU_BSTF_GetStufChunk(&l_tCtx, &l_auStuffedChunk[l_uFilledL], 3u, &l_uVarTemp32);
+        l_uFilledL += l_uVarTemp32;
+    }
+    while( ( e_eCU_BSTF_RES_OK == l_eRes ) && ( ( l_uFilledL + 3u ) <= sizeof(l_auStuffedChunk) ) );
+
+    if( ( true == l_bTestOk ) && ( e_eCU_BSTF_RES_FRAMEENDED == l_eRes ) && ( l_uStuffedL == l_uFilledL ) &&
+        ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 5  -- FAIL \n");
+    }
+
+    /* Function, a new frame from the internal buffer is still possible */
+    l_auMemArea[0u] = 0x01u;
+    l_auMemArea[1u] = ECU_EOF;
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrame(&l_tCtx, 2u) ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) &&
+        ( 5u == l_uVarTemp32 ) && ( ECU_SOF == l_auStuffedChunk[0u] ) && ( 0x01u == l_auStuffedChunk[1u] ) &&
+        ( ECU_ESC == l_auStuffedChunk[2u] ) && ( ( (uint8_t)~ECU_EOF ) == l_auStuffedChunk[3u] ) &&
+        ( ECU_EOF == l_auStuffedChunk[4u] ) )
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 6  -- FAIL \n");
+    }
+
+    /* Function, corrupted external pointer */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tCtx, l_auExtFrame, sizeof(l_auExtFrame)) ) )
+    {
+        l_tCtx.puFrame = NULL;
+        if( e_eCU_BSTF_RES_CORRUPTCTX == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                               &l_uVarTemp32) )
+        {
+            (void)printf("eCU_BSTFTST_ExtFrame 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BSTFTST_ExtFrame 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_ExtFrame 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_SegFrame(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    t_eCU_BSTF_Seg l_atSeg[4u];
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auHeader[3u];
+    uint8_t  l_auPayload[20u];
+    uint8_t  l_auTrailer[2u];
+    uint8_t  l_auFrame[25u];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(25u)];
+    uint8_t  l_auStuffedChunk[ECU_BSTF_MAXSTUFFL(25u)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uFilledL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uChunkL;
+    uint32_t l_uIdx;
+    e_eCU_BSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Init variable, escaped byte at the end and at the start of a segment */
+    l_auHeader[0u] = 0x10u;
+    l_auHeader[1u] = 0x11u;
+    l_auHeader[2u] = ECU_ESC;
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        l_auPayload[l_uIdx] = (uint8_t)( 0x20u + l_uIdx );
+    }
+    l_auPayload[0u] = ECU_SOF;
+    l_auPayload[10u] = ECU_EOF;
+    l_auTrailer[0u] = 0x30u;
+    l_auTrailer[1u] = ECU_EOF;
+    l_atSeg[0u].puData = l_auHeader;
+    l_atSeg[0u].uDataL = sizeof(l_auHeader);
+    l_atSeg[1u].puData = l_auPayload;
+    l_atSeg[1u].uDataL = 0u;
+    l_atSeg[2u].puData = l_auPayload;
+    l_atSeg[2u].uDataL = sizeof(l_auPayload);
+    l_atSeg[3u].puData = l_auTrailer;
+    l_atSeg[3u].uDataL = sizeof(l_auTrailer);
+
+    (void)memcpy(&l_auFrame[0u], l_auHeader, sizeof(l_auHeader));
+    (void)memcpy(&l_auFrame[3u], l_auPayload, sizeof(l_auPayload));
+    (void)memcpy(&l_auFrame[23u], l_auTrailer, sizeof(l_auTrailer));
+    (void)eCU_BSTF_StuffBuf(l_auFrame, sizeof(l_auFrame), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_NewFrameSeg(NULL, l_atSeg, 4u) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_NewFrameSeg(&l_tCtx, NULL, 4u) ) &&
+        ( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 4u) ) )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 0u) ) &&
+        ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_NewFrameSeg(&l_tCtx, &l_atSeg[1u], 1u) ) )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 2  -- FAIL \n");
+    }
+
+    /* Function */
+    l_atSeg[1u].puData = NULL;
+    if( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 4u) )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 3  -- FAIL \n");
+    }
+    l_atSeg[1u].puData = l_auPayload;
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 4u) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) ) &&
+        ( l_uStuffedL == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 4  -- FAIL \n");
+    }
+
+    /* Function, every chunk size must give the same frame of the contiguous payload */
+    l_bTestOk = true;
+    for( l_uChunkL = 1u; ( l_uChunkL <= 9u ) && ( true == l_bTestOk ); l_uChunkL++ )
+    {
+        (void)memset(l_auStuffedChunk, 0, sizeof(l_auStuffedChunk));
+        l_uFilledL = 0u;
+
+        if( e_eCU_BSTF_RES_OK != eCU_BSTF_RestartFrame(&l_tCtx) )
+        {
+            l_bTestOk = false;
+        }
+
+        do
+        {
+            if( ( e_eCU_BSTF_RES_OK != eCU_BSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) ) ||
+                ( ( l_uStuffedL - l_uFilledL ) != l_uVarTemp32 ) )
+            {
+                l_bTestOk = false;
+            }
+
+            l_eRes = eCU_BSTF_GetStufChunk(&l_tCtx, &l_auStuffedChunk[l_uFilledL], l_uChunkL, &l_uVarTemp32);
+            l_uFilledL += l_uVarTemp32;
+        }
+        while( ( e_eCU_BSTF_RES_OK == l_eRes ) && ( ( l_uFilledL + l_uChunkL ) <= sizeof(l_auStuffedChunk) ) );
+
+        if( ( e_eCU_BSTF_RES_FRAMEENDED != l_eRes ) || ( l_uStuffedL != l_uFilledL ) ||
+            ( 0 != memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 5  -- FAIL \n");
+    }
+
+    /* Function, corrupted segment index */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_RestartFrame(&l_tCtx) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, 4u, &l_uVarTemp32) ) )
+    {
+        l_tCtx.uSegIdx = 4u;
+        if( e_eCU_BSTF_RES_CORRUPTCTX == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, 4u, &l_uVarTemp32) )
+        {
+            (void)printf("eCU_BSTFTST_SegFrame 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BSTFTST_SegFrame 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 6  -- FAIL \n");
+    }
+
+    /* Function, a single memory area frame clean the segment status */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 4u) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tCtx, l_auFrame, sizeof(l_auFrame)) ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) &&
+        ( l_uStuffedL == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_SegFrame 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_CrcMode(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    t_eCU_BSTF_Seg l_atSeg[2u];
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auFrameCrc[20u + ECU_BSTF_CRCL];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(20u + ECU_BSTF_CRCL)];
+    uint8_t  l_auStuffedChunk[ECU_BSTF_MAXSTUFFL(20u + ECU_BSTF_CRCL)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uFilledL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uCrc;
+    uint32_t l_uChunkL;
+    uint32_t l_uIdx;
+    uint32_t l_uMode;
+    e_eCU_BSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_SetCrcMode(NULL, true) ) &&
+        ( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_SetCrcMode(&l_tCtx, true) ) )
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 1  -- FAIL \n");
+    }
+
+    /* Function, changing the mode discharge the frame */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_SetCrcMode(&l_tCtx, true) ) &&
+        ( e_eCU_BSTF_RES_NOINITFRAME == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                              &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 2  -- FAIL \n");
+    }
+
+    /* Init variable, expected frame is the stuffed payload followed by its CRC in big endian */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMemArea); l_uIdx++ )
+    {
+        l_auMemArea[l_uIdx] = (uint8_t)( 0x90u + ( l_uIdx * 3u ) );
+    }
+    (void)eCU_CRC_32(l_auMemArea, sizeof(l_auMemArea), &l_uCrc);
+    (void)memcpy(l_auFrameCrc, l_auMemArea, sizeof(l_auMemArea));
+    l_auFrameCrc[20u] = (uint8_t)( l_uCrc >> 24u );
+    l_auFrameCrc[21u] = (uint8_t)( l_uCrc >> 16u );
+    l_auFrameCrc[22u] = (uint8_t)( l_uCrc >> 8u );
+    l_auFrameCrc[23u] = (uint8_t)( l_uCrc );
+    (void)eCU_BSTF_StuffBuf(l_auFrameCrc, sizeof(l_auFrameCrc), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+    l_atSeg[0u].puData = l_auMemArea;
+    l_atSeg[0u].uDataL = 7u;
+    l_atSeg[1u].puData = &l_auMemArea[7u];
+    l_atSeg[1u].uDataL = sizeof(l_auMemArea) - 7u;
+
+    /* Function, internal buffer and segments with every chunk size */
+    l_bTestOk = true;
+    for( l_uMode = 0u; ( l_uMode < 2u ) && ( true == l_bTestOk ); l_uMode++ )
+    {
+        for( l_uChunkL = 1u; ( l_uChunkL <= 9u ) && ( true == l_bTestOk ); l_uChunkL++ )
+        {
+            (void)memset(l_auStuffedChunk, 0, sizeof(l_auStuffedChunk));
+            l_uFilledL = 0u;
+
+            if( 0u == l_uMode )
+            {
+                l_eRes = eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea));
+            }
+            else
+            {
+                l_eRes = eCU_BSTF_NewFrameSeg(&l_tCtx, l_atSeg, 2u);
+            }
+
+            if( e_eCU_BSTF_RES_OK != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+
+            do
+            {
+                if( ( e_eCU_BSTF_RES_OK != eCU_BSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) ) ||
+                    ( ( l_uStuffedL - l_uFilledL ) != l_uVarTemp32 ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_eRes = eCU_BSTF_GetStufChunk(&l_tCtx, &l_auStuffedChunk[l_uFilledL], l_uChunkL, &l_uVarTemp32);
+                l_uFilledL += l_uVarTemp32;
+            }
+            while( ( e_eCU_BSTF_RES_OK == l_eRes ) && ( ( l_uFilledL + l_uChunkL ) <= sizeof(l_auStuffedChunk) ) );
+
+            if( ( e_eCU_BSTF_RES_FRAMEENDED != l_eRes ) || ( l_uStuffedL != l_uFilledL ) ||
+                ( 0 != memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 3  -- FAIL \n");
+    }
+
+    /* Function, restart in the middle of the CRC recalculate it from the start */
+    l_bTestOk = true;
+    if( ( e_eCU_BSTF_RES_OK != eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) ||
+        ( e_eCU_BSTF_RES_OK != eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, l_uStuffedL - 2u,
+                                                      &l_uVarTemp32) ) ||
+        ( e_eCU_BSTF_RES_OK != eCU_BSTF_RestartFrame(&l_tCtx) ) )
+    {
+        l_bTestOk = false;
+    }
+
+    (void)memset(l_auStuffedChunk, 0, sizeof(l_auStuffedChunk));
+    if( ( true == l_bTestOk ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) &&
+        ( l_uStuffedL == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 4  -- FAIL \n");
+    }
+
+    /* Function, corrupted trailer status */
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, l_uStuffedL - 2u,
+                                                     &l_uVarTemp32) ) )
+    {
+        l_tCtx.uSegStart = 0u;
+        if( e_eCU_BSTF_RES_CORRUPTCTX == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                               &l_uVarTemp32) )
+        {
+            (void)printf("eCU_BSTFTST_CrcMode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BSTFTST_CrcMode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 5  -- FAIL \n");
+    }
+
+    /* Function, without CRC the frame is the plain stuffed payload */
+    (void)eCU_BSTF_StuffBuf(l_auMemArea, sizeof(l_auMemArea), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_SetCrcMode(&l_tCtx, true) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_SetCrcMode(&l_tCtx, false) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) &&
+        ( l_uStuffedL == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CrcMode 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_CirqOut(void)
+{
+    /* Local variable */
+    t_eCU_BSTF_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_tCirq;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auCirqArea[6u];
+    uint8_t  l_auRetrived[6u];
+    uint8_t  l_auPayload[] = { 0x01u, ECU_SOF, 0x02u, 0x03u };
+    uint8_t  l_auStuffed[] = { ECU_SOF, 0x01u, ECU_ESC, (uint8_t)~ECU_SOF, 0x02u, 0x03u, ECU_EOF };
+    uint32_t l_uGettedL;
+
+    /* Init variable */
+    l_tCirq.bIsInit = false;
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_GetStufChunkCirq(NULL, &l_tCirq, &l_uGettedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_GetStufChunkCirq(&l_tCtx, NULL, &l_uGettedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, NULL) ) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 1  -- FAIL \n");
+    }
+
+    /* Function, the stuffer is checked before the queue, then the queue not initialized */
+    if( ( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BSTF_RES_NOINITFRAME == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_NewFrameExt(&l_tCtx, l_auPayload, sizeof(l_auPayload)) ) &&
+        ( e_eCU_BSTF_RES_NOINITLIB == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_InitCtx(&l_tCirq, l_auCirqArea, sizeof(l_auCirqArea)) ) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 2  -- FAIL \n");
+    }
+
+    /* Function, the free space of the queue wrap */
+    (void)eCU_CIRQ_InsertData(&l_tCirq, l_auPayload, 4u);
+    (void)eCU_CIRQ_RetriveData(&l_tCirq, l_auRetrived, 4u);
+    (void)eCU_BSTF_NewFrameExt(&l_tCtx, l_auPayload, sizeof(l_auPayload));
+    if( ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) && ( 6u == l_uGettedL ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) && ( 0u == l_uGettedL ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_RetriveData(&l_tCirq, l_auRetrived, 6u) ) &&
+        ( 0 == memcmp(l_auRetrived, l_auStuffed, 6u) ) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 3  -- FAIL \n");
+    }
+
+    /* Function, the queue has space for the end of the frame */
+    if( ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) && ( 1u == l_uGettedL ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_RetriveData(&l_tCirq, l_auRetrived, 1u) ) && ( ECU_EOF == l_auRetrived[0u] ) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 4  -- FAIL \n");
+    }
+
+    /* Function, a full queue doesn't hide the state of the frame */
+    (void)eCU_CIRQ_InsertData(&l_tCirq, l_auStuffed, 6u);
+    if( ( e_eCU_BSTF_RES_FRAMEENDED == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) && ( 0u == l_uGettedL ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_RestartFrame(&l_tCtx) ) &&
+        ( e_eCU_BSTF_RES_OK == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) ) && ( 0u == l_uGettedL ) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 5  -- FAIL \n");
+    }
+
+    /* Function, corrupted queue */
+    (void)eCU_CIRQ_RetriveData(&l_tCirq, l_auRetrived, 6u);
+    l_tCirq.uBuffFreeIdx = sizeof(l_auCirqArea);
+    if( e_eCU_BSTF_RES_CORRUPTCTX == eCU_BSTF_GetStufChunkCirq(&l_tCtx, &l_tCirq, &l_uGettedL) )
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_CirqOut 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BSTFTST_StuffBatch(void)
+{
+    /* Local variable */
+    uint8_t  l_auPayloadA[] = { 0x01u, ECU_SOF, 0x02u };
+    uint8_t  l_auPayloadB[] = { ECU_ESC };
+    uint8_t  l_auPayloadC[] = { 0x03u, 0x04u, ECU_EOF, 0x05u };
+    t_eCU_BSTF_Seg l_atFrame[3u];
+    t_eCU_BSTF_Seg l_atBadFrame[2u];
+    uint8_t  l_auStuffed[32u];
+    uint8_t  l_auExpected[32u];
+    uint32_t l_auFrameOff[3u];
+    uint32_t l_uStuffedN;
+    uint32_t l_uStuffedL;
+    uint32_t l_uExpectedL;
+    uint32_t l_uOneL;
+
+    /* Init variable */
+    l_atFrame[0u].puData = l_auPayloadA;
+    l_atFrame[0u].uDataL = sizeof(l_auPayloadA);
+    l_atFrame[1u].puData = l_auPayloadB;
+    l_atFrame[1u].uDataL = sizeof(l_auPayloadB);
+    l_atFrame[2u].puData = l_auPayloadC;
+    l_atFrame[2u].uDataL = sizeof(l_auPayloadC);
+    l_atBadFrame[0u] = l_atFrame[0u];
+    l_atBadFrame[1u].puData = l_auPayloadB;
+    l_atBadFrame[1u].uDataL = 0u;
+
+    /* Expected output is the same of stuffing every frame one by one */
+    l_uExpectedL = 0u;
+    (void)eCU_BSTF_StuffBuf(l_auPayloadA, sizeof(l_auPayloadA), &l_auExpected[l_uExpectedL],
+                            ( sizeof(l_auExpected) - l_uExpectedL ), &l_uOneL);
+    l_uExpectedL += l_uOneL;
+    (void)eCU_BSTF_StuffBuf(l_auPayloadB, sizeof(l_auPayloadB), &l_auExpected[l_uExpectedL],
+                            ( sizeof(l_auExpected) - l_uExpectedL ), &l_uOneL);
+    l_uExpectedL += l_uOneL;
+    (void)eCU_BSTF_StuffBuf(l_auPayloadC, sizeof(l_auPayloadC), &l_auExpected[l_uExpectedL],
+                            ( sizeof(l_auExpected) - l_uExpectedL ), &l_uOneL);
+    l_uExpectedL += l_uOneL;
+
+    /* Function */
+    if( ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBatch(NULL, 3u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBatch(l_atFrame, 3u, NULL, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, sizeof(l_auStuffed), NULL, &l_uStuffedN, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, NULL, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_BADPOINTER == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, NULL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 1  -- FAIL \n");
+    }
+    if( ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_StuffBatch(l_atFrame, 0u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) ) &&
+        ( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, 0u, l_auFrameOff, &l_uStuffedN, &l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eCU_BSTF_RES_OK == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 3  -- FAIL \n");
+    }
+    /* Same output of the single frame stuffer */
+    if( ( 3u == l_uStuffedN ) && ( l_uExpectedL == l_uStuffedL ) && ( 0 == memcmp(l_auStuffed, l_auExpected, l_uExpectedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 4  -- FAIL \n");
+    }
+    /* Every frame start where the previous one end */
+    if( ( 0u == l_auFrameOff[0u] ) && ( 6u == l_auFrameOff[1u] ) && ( 10u == l_auFrameOff[2u] ) &&
+        ( ECU_SOF == l_auStuffed[l_auFrameOff[1u]] ) && ( ECU_SOF == l_auStuffed[l_auFrameOff[2u]] ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 5  -- FAIL \n");
+    }
+
+    /* Function, the last frame doesn't fit */
+    if( e_eCU_BSTF_RES_OUTOFMEM == eCU_BSTF_StuffBatch(l_atFrame, 3u, l_auStuffed, ( l_uExpectedL - 1u ), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 6  -- FAIL \n");
+    }
+    if( ( 2u == l_uStuffedN ) && ( 10u == l_uStuffedL ) && ( 0 == memcmp(l_auStuffed, l_auExpected, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 7  -- FAIL \n");
+    }
+
+    /* Function, stuff the remaining frame */
+    if( e_eCU_BSTF_RES_OK == eCU_BSTF_StuffBatch(&l_atFrame[l_uStuffedN], ( 3u - l_uStuffedN ), l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 8  -- FAIL \n");
+    }
+    if( ( 1u == l_uStuffedN ) && ( ( l_uExpectedL - 10u ) == l_uStuffedL ) && ( 0 == memcmp(l_auStuffed, &l_auExpected[10u], l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 9  -- FAIL \n");
+    }
+
+    /* Function, an empty payload stop the batch */
+    if( e_eCU_BSTF_RES_BADPARAM == eCU_BSTF_StuffBatch(l_atBadFrame, 2u, l_auStuffed, sizeof(l_auStuffed), l_auFrameOff, &l_uStuffedN, &l_uStuffedL) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 10 -- FAIL \n");
+    }
+    if( ( 1u == l_uStuffedN ) && ( 6u == l_uStuffedL ) && ( 0 == memcmp(l_auStuffed, l_auExpected, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BSTFTST_StuffBatch 11 -- FAIL \n");
+    }
+}
\ No newline at end of file
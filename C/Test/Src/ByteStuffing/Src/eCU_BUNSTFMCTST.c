@@ -0,0 +1,816 @@
+/**
+ * @file       eCU_BUNSTFMCTST.c
+ *
+ * @brief      Multi channel byte unstuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_BUNSTFMCTST.h"
+#include "eCU_BUNSTFMC.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_BUNSTFMCTST_BadPointer(void);
+static void eCU_BUNSTFMCTST_BadInit(void);
+static void eCU_BUNSTFMCTST_BadParamEntr(void);
+static void eCU_BUNSTFMCTST_CorruptCtx(void);
+static void eCU_BUNSTFMCTST_General(void);
+static void eCU_BUNSTFMCTST_Frame(void);
+static void eCU_BUNSTFMCTST_SharedFlag(void);
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_BUNSTFMCTST_ExeTest(void)
+{
+	(void)printf("\n\nMULTI CHANNEL BYTE UNSTUFFER TEST START \n\n");
+
+    eCU_BUNSTFMCTST_BadPointer();
+    eCU_BUNSTFMCTST_BadInit();
+    eCU_BUNSTFMCTST_BadParamEntr();
+    eCU_BUNSTFMCTST_CorruptCtx();
+    eCU_BUNSTFMCTST_General();
+    eCU_BUNSTFMCTST_Frame();
+    eCU_BUNSTFMCTST_SharedFlag();
+
+    (void)printf("\n\nMULTI CHANNEL BYTE UNSTUFFER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_BUNSTFMCTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChan;
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    uint8_t  l_auPool[16u];
+    uint8_t  l_auStuff[] = { ECU_SOF, 0x11u, ECU_EOF };
+    uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InitCtx(NULL, l_auPool, sizeof(l_auPool), 8u) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InitCtx(&l_tCtx, NULL, sizeof(l_auPool), 8u) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_SetCfg(NULL, &l_tCfg) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_SetCfg(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InitChan(NULL, &l_tChan) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InitChan(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_CloseChan(NULL, &l_tChan) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_CloseChan(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(NULL, &l_tChan, l_auStuff, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, NULL, l_auStuff, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, NULL, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff), NULL, &l_puFrame,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff), &l_uConsumed, NULL,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                     NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_RelFrame(NULL, l_auPool) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 17 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_RelFrame(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 18 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_GetFreeBuff(NULL, &l_uNFree) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 19 -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_BADPOINTER == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadPointer 20 -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChan;
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    uint8_t  l_auPool[16u];
+    uint8_t  l_auStuff[] = { ECU_SOF, 0x11u, ECU_EOF };
+    uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+
+    /* Function */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_SetCfg(&l_tCtx, &l_tCfg) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChan) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_CloseChan(&l_tCtx, &l_tChan) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                    &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_auPool) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTFMC_RES_NOINITLIB == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadInit 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChan;
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    uint8_t  l_auPool[16u];
+    uint8_t  l_auBigPool[( ECU_BUNSTFMC_MAXBUFF + 1u ) * ECU_BUNSTFMC_MINFRAMEL];
+    uint8_t  l_auOther[8u];
+    uint8_t  l_auStuff[] = { ECU_SOF, 0x11u, ECU_EOF };
+    uint8_t  l_auHalf[] = { ECU_SOF, 0x11u };
+    uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+
+    /* Init variable */
+    l_tCfg.bIsInit = false;
+
+    /* Function, frame buffer too small */
+    if( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 3u) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* Function, not even a frame buffer */
+    if( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, 7u, 8u) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    /* Function, configuration not initialized */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 8u) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_SetCfg(&l_tCtx, &l_tCfg) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* Function, empty chunk */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChan) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, 0u, &l_uConsumed, &l_puFrame,
+                                                                  &l_uFrameL) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* Function, every buffer is already free */
+    if( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_auPool) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    /* Function, pointer that is not a frame buffer */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, &l_puFrame[1u]) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, &l_auPool[16u]) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    /* Function, pointer outside the pool */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_auOther) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    /* Function, frame released two times */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    /* Function, frame buffer still owned by a channel */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auHalf, sizeof(l_auHalf),
+                                                            &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_auPool) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_CloseChan(&l_tCtx, &l_tChan) ) &&
+        ( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_auPool) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    /* Function, too many frame buffer */
+    if( e_eCU_BUNSTFMC_RES_BADPARAM == eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auBigPool, sizeof(l_auBigPool),
+                                                            ECU_BUNSTFMC_MINFRAMEL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_BadParamEntr 10 -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_CorruptCtx(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChan;
+    uint8_t  l_auPool[16u];
+    uint8_t  l_auStuff[] = { ECU_SOF, 0x11u, ECU_EOF };
+    uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+
+    /* Init variable */
+    (void)eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 8u);
+    l_tCtx.uNFree = 3u;
+
+    /* Function, free counter not valid */
+    if( e_eCU_BUNSTFMC_RES_CORRUPTCTX == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 1  -- FAIL \n");
+    }
+
+    /* Function, channel waiting SOF in a wrong status */
+    (void)eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 8u);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChan);
+    l_tChan.eSM = e_eCU_BUNSTFPRV_SM_NEEDRAWDATA;
+    if( e_eCU_BUNSTFMC_RES_CORRUPTCTX == eCU_BUNSTFMC_CloseChan(&l_tCtx, &l_tChan) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 2  -- FAIL \n");
+    }
+
+    /* Function, channel owning a buffer not present */
+    l_tChan.uBuffIdx = 2u;
+    if( e_eCU_BUNSTFMC_RES_CORRUPTCTX == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auStuff, sizeof(l_auStuff), &l_uConsumed, &l_puFrame,
+                                                                     &l_uFrameL) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_CorruptCtx 3  -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_General(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChanA;
+    t_eCU_BUNSTFMC_Chan l_tChanB;
+    uint8_t  l_auPool[24u];
+    uint8_t  l_auStuffA1[] = { 0x00u, ECU_SOF, 0x11u, ECU_ESC, (uint8_t)~ECU_SOF };
+    uint8_t  l_auStuffB[] = { ECU_SOF, 0x33u, ECU_EOF };
+    uint8_t  l_auStuffA2[] = { 0x22u, ECU_EOF, 0x44u };
+    uint8_t* l_puFrameA;
+    uint8_t* l_puFrameB;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+
+    /* Init variable */
+    (void)eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 8u);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChanA);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChanB);
+
+    /* Function, no buffer is used while waiting the SOF */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auStuffA1, 1u, &l_uConsumed, &l_puFrameA,
+                                                            &l_uFrameL) ) && ( 1u == l_uConsumed ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 3u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 1  -- FAIL \n");
+    }
+
+    /* Function, the frame in progress own a buffer */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, &l_auStuffA1[1u], 4u, &l_uConsumed,
+                                                            &l_puFrameA, &l_uFrameL) ) && ( 4u == l_uConsumed ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 2u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 2  -- FAIL \n");
+    }
+
+    /* Function, another channel is not influenced */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanB, l_auStuffB, sizeof(l_auStuffB),
+                                                                    &l_uConsumed, &l_puFrameB, &l_uFrameL) ) &&
+        ( 3u == l_uConsumed ) && ( 1u == l_uFrameL ) && ( 0x33u == l_puFrameB[0u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 1u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 3  -- FAIL \n");
+    }
+
+    /* Function, the frame is the buffer of the pool */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auStuffA2, sizeof(l_auStuffA2),
+                                                                    &l_uConsumed, &l_puFrameA, &l_uFrameL) ) &&
+        ( 2u == l_uConsumed ) && ( 3u == l_uFrameL ) && ( l_puFrameA == &l_auPool[0u] ) &&
+        ( 0x11u == l_puFrameA[0u] ) && ( ECU_SOF == l_puFrameA[1u] ) && ( 0x22u == l_puFrameA[2u] ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 4  -- FAIL \n");
+    }
+
+    /* Function, the frame is not touched until released */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auStuffB, 2u, &l_uConsumed, &l_puFrameB,
+                                                            &l_uFrameL) ) &&
+        ( 0x11u == l_auPool[0u] ) && ( 0x33u == l_auPool[8u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 0u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 5  -- FAIL \n");
+    }
+
+    /* Function, give back every buffer */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrameA) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, &l_auPool[8u]) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_CloseChan(&l_tCtx, &l_tChanA) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 3u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_General 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_Frame(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChanA;
+    t_eCU_BUNSTFMC_Chan l_tChanB;
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    uint8_t  l_auPool[4u];
+    uint8_t  l_auStuffA[] = { ECU_SOF, 0x11u };
+    uint8_t  l_auStuffB[] = { 0x00u, ECU_SOF, 0x22u, ECU_EOF };
+    uint8_t  l_auBad[] = { ECU_SOF, ECU_EOF };
+    uint8_t  l_auLong[] = { ECU_SOF, 0x01u, 0x02u, 0x03u, 0x04u, 0x05u, ECU_EOF, ECU_SOF, 0x07u, ECU_EOF };
+    uint8_t  l_auRestart[] = { ECU_SOF, 0x11u, ECU_SOF, 0x22u, ECU_EOF };
+    uint8_t  l_auHdlc[] = { 0x7Eu, 0x7Eu, 0x11u, 0x7Du, 0x5Eu, 0x7Eu };
+    uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+
+    /* Init variable */
+    (void)eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 4u);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChanA);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChanB);
+    (void)eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auStuffA, sizeof(l_auStuffA), &l_uConsumed, &l_puFrame,
+                                    &l_uFrameL);
+    (void)eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auStuffA, sizeof(l_auStuffA), &l_uConsumed, &l_puFrame,
+                                    &l_uFrameL);
+
+    /* Function, every buffer is used */
+    if( ( e_eCU_BUNSTFMC_RES_NOFREEBUFF == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanB, l_auStuffB, sizeof(l_auStuffB),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( 1u == l_uConsumed ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 1  -- FAIL \n");
+    }
+
+    /* Function, closing a channel free his buffer */
+    if( ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_CloseChan(&l_tCtx, &l_tChanA) ) &&
+        ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanB, &l_auStuffB[1u], 3u, &l_uConsumed,
+                                                                    &l_puFrame, &l_uFrameL) ) &&
+        ( 3u == l_uConsumed ) && ( 1u == l_uFrameL ) && ( 0x22u == l_puFrame[0u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 2  -- FAIL \n");
+    }
+
+    /* Function, bad frame give back the buffer */
+    if( ( e_eCU_BUNSTFMC_RES_BADFRAME == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auBad, sizeof(l_auBad), &l_uConsumed,
+                                                                  &l_puFrame, &l_uFrameL) ) &&
+        ( 2u == l_uConsumed ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 1u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 3  -- FAIL \n");
+    }
+
+    /* Function, frame too long give back the buffer */
+    if( ( e_eCU_BUNSTFMC_RES_OUTOFMEM == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auLong, sizeof(l_auLong), &l_uConsumed,
+                                                                  &l_puFrame, &l_uFrameL) ) &&
+        ( 5u == l_uConsumed ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 1u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 4  -- FAIL \n");
+    }
+
+    /* Function, the rest of the frame too long is discharged */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, &l_auLong[5u], 5u, &l_uConsumed,
+                                                                    &l_puFrame, &l_uFrameL) ) &&
+        ( 5u == l_uConsumed ) && ( 1u == l_uFrameL ) && ( 0x07u == l_puFrame[0u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 5  -- FAIL \n");
+    }
+
+    /* Function, restart use the same buffer */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanA, l_auRestart, sizeof(l_auRestart),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( 5u == l_uConsumed ) && ( 1u == l_uFrameL ) && ( 0x22u == l_puFrame[0u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 0u == l_uNFree ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrame) ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 6  -- FAIL \n");
+    }
+
+    /* Function, channel using a custom delimiter, the closing flag is left because the only buffer is in use */
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTFMC_SetCfg(&l_tCtx, &l_tCfg);
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChanB, l_auHdlc, sizeof(l_auHdlc),
+                                                                    &l_uConsumed, &l_puFrame, &l_uFrameL) ) &&
+        ( 5u == l_uConsumed ) && ( 2u == l_uFrameL ) && ( 0x11u == l_puFrame[0u] ) && ( 0x7Eu == l_puFrame[1u] ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_Frame 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BUNSTFMCTST_SharedFlag(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTFMC_Ctx l_tCtx;
+    t_eCU_BUNSTFMC_Chan l_tChan;
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    uint8_t  l_auPool[8u];
+    uint8_t  l_auHdlc[] = { 0x7Eu, 0x61u, 0x62u, 0x7Eu, 0x63u, 0x64u, 0x7Eu, 0x7Eu, 0x65u, 0x7Eu };
+    uint8_t* l_puFrameA;
+    uint8_t* l_puFrameB;
+    uint32_t l_uFrameL;
+    uint32_t l_uConsumed;
+    uint32_t l_uNFree;
+
+    /* Init variable */
+    (void)eCU_BUNSTFMC_InitCtx(&l_tCtx, l_auPool, sizeof(l_auPool), 4u);
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTFMC_SetCfg(&l_tCtx, &l_tCfg);
+    (void)eCU_BUNSTFMC_InitChan(&l_tCtx, &l_tChan);
+
+    /* Function, the flag that close the first frame open the second one in a new buffer */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, l_auHdlc, sizeof(l_auHdlc),
+                                                                        &l_uConsumed, &l_puFrameA, &l_uFrameL) ) &&
+        ( 4u == l_uConsumed ) && ( 2u == l_uFrameL ) && ( 0x61u == l_puFrameA[0u] ) && ( 0x62u == l_puFrameA[1u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 0u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 1  -- FAIL \n");
+    }
+
+    /* Function, no more free buffer, the closing flag is left for the next call */
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, &l_auHdlc[4u], 6u,
+                                                                        &l_uConsumed, &l_puFrameB, &l_uFrameL) ) &&
+        ( 2u == l_uConsumed ) && ( 2u == l_uFrameL ) && ( 0x63u == l_puFrameB[0u] ) && ( 0x64u == l_puFrameB[1u] ) &&
+        ( e_eCU_BUNSTFMC_RES_NOFREEBUFF == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, &l_auHdlc[6u], 4u,
+                                                                        &l_uConsumed, &l_puFrameB, &l_uFrameL) ) &&
+        ( 0u == l_uConsumed ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 2  -- FAIL \n");
+    }
+
+    /* Function, after a release the left flag open the frame, and the doubled flag is not an empty frame */
+    (void)eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrameA);
+    if( ( e_eCU_BUNSTFMC_RES_FRAMEENDED == eCU_BUNSTFMC_InsStufChunk(&l_tCtx, &l_tChan, &l_auHdlc[6u], 4u,
+                                                                        &l_uConsumed, &l_puFrameA, &l_uFrameL) ) &&
+        ( 3u == l_uConsumed ) && ( 1u == l_uFrameL ) && ( 0x65u == l_puFrameA[0u] ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrameA) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_RelFrame(&l_tCtx, l_puFrameB) ) &&
+        ( e_eCU_BUNSTFMC_RES_OK == eCU_BUNSTFMC_GetFreeBuff(&l_tCtx, &l_uNFree) ) && ( 2u == l_uNFree ) )
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUNSTFMCTST_SharedFlag 3  -- FAIL \n");
+    }
+}
\ No newline at end of file
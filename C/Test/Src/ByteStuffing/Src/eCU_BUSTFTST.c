@@ -13,10 +13,28 @@
 #include "eCU_BUSTFTST.h"
 #include "eCU_BSTF.h"
 #include "eCU_BUNSTF.h"
+#include "eCU_CRC.h"
 #include <stdio.h>
 
 
 
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+struct t_eCU_BUNSTF_FrameCtxUser
+{
+    uint32_t uFrameN;
+    bool_t   bRetVal;
+    e_eCU_BUNSTF_RES aeFrameRes[8u];
+    uint32_t auFrameL[8u];
+    uint8_t  auFrame[8u][16u];
+};
+
+static bool_t eCU_BUSTFTST_FrameCb(t_eCU_BUNSTF_FrameCtx* const p_ptCtx, const e_eCU_BUNSTF_RES p_eFrameRes,
+                                   const uint8_t* p_puFrame, const uint32_t p_uFrameL);
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
@@ -30,6 +48,15 @@ static void eCU_BUSTFTST_General(void);
 static void eCU_BUSTFTST_CornerCase(void);
 static void eCU_BUSTFTST_CornerCase2(void);
 static void eCU_BUSTFTST_CodeCoverage(void);
+static void eCU_BUSTFTST_LongRun(void);
+static void eCU_BUSTFTST_MultiFrame(void);
+static void eCU_BUSTFTST_OneShot(void);
+static void eCU_BUSTFTST_CrcMode(void);
+static void eCU_BUSTFTST_SplitAtSof(void);
+static void eCU_BUSTFTST_HuntMode(void);
+static void eCU_BUSTFTST_CirqIn(void);
+static void eCU_BUSTFTST_InPlace(void);
+static void eCU_BUSTFTST_SharedFlag(void);
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
@@ -48,6 +75,15 @@ void eCU_BUSTFTST_ExeTest(void)
     eCU_BUSTFTST_CornerCase();
     eCU_BUSTFTST_CornerCase2();
     eCU_BUSTFTST_CodeCoverage();
+    eCU_BUSTFTST_LongRun();
+    eCU_BUSTFTST_MultiFrame();
+    eCU_BUSTFTST_OneShot();
+    eCU_BUSTFTST_CrcMode();
+    eCU_BUSTFTST_SplitAtSof();
+    eCU_BUSTFTST_HuntMode();
+    eCU_BUSTFTST_CirqIn();
+    eCU_BUSTFTST_InPlace();
+    eCU_BUSTFTST_SharedFlag();
 
     (void)printf("\n\nBYTE UNSTUFFER TEST END \n\n");
 }
@@ -56,6 +92,28 @@ void eCU_BUSTFTST_ExeTest(void)
 
 
 
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eCU_BUSTFTST_FrameCb(t_eCU_BUNSTF_FrameCtx* const p_ptCtx, const e_eCU_BUNSTF_RES p_eFrameRes,
+                                   const uint8_t* p_puFrame, const uint32_t p_uFrameL)
+{
+    if( p_ptCtx->uFrameN < 8u )
+    {
+        p_ptCtx->aeFrameRes[p_ptCtx->uFrameN] = p_eFrameRes;
+        p_ptCtx->auFrameL[p_ptCtx->uFrameN] = p_uFrameL;
+        if( p_uFrameL <= 16u )
+        {
+            (void)memcpy(p_ptCtx->auFrame[p_ptCtx->uFrameN], p_puFrame, p_uFrameL);
+        }
+    }
+    p_ptCtx->uFrameN++;
+
+    return p_ptCtx->bRetVal;
+}
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
@@ -3178,4 +3236,1165 @@ static void eCU_BUSTFTST_CodeCoverage(void)
     {
         (void)printf("eCU_BUSTFTST_CodeCoverage 7  -- FAIL \n");
     }
+}
+
+static void eCU_BUSTFTST_LongRun(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auPayload[300u];
+    uint8_t  l_auStuffed[602u];
+    uint32_t l_uStuffedL;
+    uint32_t l_uConsumedL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uChunkL;
+    uint32_t l_uIdx;
+    uint8_t* l_puData;
+    e_eCU_BUNSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Init variable, long run of raw data with some special byte in every position of a word */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        l_auPayload[l_uIdx] = (uint8_t)( l_uIdx * 7u );
+    }
+    l_auPayload[0u] = ECU_SOF;
+    l_auPayload[37u] = ECU_EOF;
+    l_auPayload[38u] = ECU_ESC;
+    l_auPayload[102u] = ECU_SOF;
+    l_auPayload[199u] = ECU_ESC;
+    l_auPayload[299u] = ECU_EOF;
+
+    l_uStuffedL = 0u;
+    l_auStuffed[l_uStuffedL] = ECU_SOF;
+    l_uStuffedL++;
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        if( ( ECU_SOF == l_auPayload[l_uIdx] ) || ( ECU_EOF == l_auPayload[l_uIdx] ) ||
+            ( ECU_ESC == l_auPayload[l_uIdx] ) )
+        {
+            l_auStuffed[l_uStuffedL] = ECU_ESC;
+            l_uStuffedL++;
+            l_auStuffed[l_uStuffedL] = (uint8_t)~l_auPayload[l_uIdx];
+            l_uStuffedL++;
+        }
+        else
+        {
+            l_auStuffed[l_uStuffedL] = l_auPayload[l_uIdx];
+            l_uStuffedL++;
+        }
+    }
+    l_auStuffed[l_uStuffedL] = ECU_EOF;
+    l_uStuffedL++;
+
+    /* Function */
+    l_bTestOk = true;
+    if( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        l_bTestOk = false;
+    }
+
+    for( l_uChunkL = 1u; ( l_uChunkL <= 17u ) && ( true == l_bTestOk ); l_uChunkL++ )
+    {
+        (void)memset(l_auMemArea, 0, sizeof(l_auMemArea));
+        l_uConsumedL = 0u;
+
+        if( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_NewFrame(&l_tCtx) )
+        {
+            l_bTestOk = false;
+        }
+
+        do
+        {
+            l_uVarTemp32 = l_uStuffedL - l_uConsumedL;
+            if( l_uVarTemp32 > l_uChunkL )
+            {
+                l_uVarTemp32 = l_uChunkL;
+            }
+
+            l_eRes = eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[l_uConsumedL], l_uVarTemp32, &l_uVarTemp32);
+            l_uConsumedL += l_uVarTemp32;
+        }
+        while( ( e_eCU_BUNSTF_RES_OK == l_eRes ) && ( l_uConsumedL < l_uStuffedL ) );
+
+        if( ( e_eCU_BUNSTF_RES_FRAMEENDED != l_eRes ) || ( l_uStuffedL != l_uConsumedL ) )
+        {
+            l_bTestOk = false;
+        }
+
+        if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uVarTemp32) )
+        {
+            if( ( sizeof(l_auPayload) != l_uVarTemp32 ) || ( 0 != memcmp(l_auPayload, l_puData, l_uVarTemp32) ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 1  -- FAIL \n");
+    }
+
+    /* A run longer than the avaiable memory */
+    (void)memset(l_auStuffed, 0x11, sizeof(l_auStuffed));
+    l_auStuffed[0u] = ECU_SOF;
+    if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, 101u) )
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 2  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTF_RES_OUTOFMEM == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, 200u, &l_uConsumedL) )
+    {
+        if( 102u == l_uConsumedL )
+        {
+            (void)printf("eCU_BUSTFTST_LongRun 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_LongRun 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 3  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) )
+    {
+        if( 101u == l_uVarTemp32 )
+        {
+            (void)printf("eCU_BUSTFTST_LongRun 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_LongRun 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_LongRun 4  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_MultiFrame(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    t_eCU_BUNSTF_FrameCtx l_tCbCtx;
+    uint8_t  l_auMemArea[8u];
+    uint32_t l_uConsumedL;
+    uint8_t  l_auStuffed[] = { 0x11u, 0x22u,
+                               ECU_SOF, 0x01u, 0x02u, ECU_EOF,
+                               ECU_SOF, ECU_ESC, (uint8_t)~ECU_SOF, 0x05u, ECU_EOF,
+                               ECU_SOF, ECU_EOF,
+                               0x33u,
+                               ECU_SOF, 0x01u, 0x02u, 0x03u, 0x04u, 0x05u, 0x06u, 0x07u, 0x08u, 0x09u, 0x0Au, ECU_EOF,
+                               ECU_SOF, 0x01u, ECU_SOF, 0x02u, 0x03u, ECU_EOF,
+                               ECU_SOF, 0xAAu, 0xBBu };
+    uint8_t  l_auStuffedEnd[] = { 0xCCu, ECU_EOF };
+
+    /* Init variable */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), NULL,
+                                                                    &l_tCbCtx, &l_uConsumedL) )
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 1  -- FAIL \n");
+    }
+
+    if( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                                   &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) )
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 2  -- FAIL \n");
+    }
+
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, 0u, &eCU_BUSTFTST_FrameCb,
+                                                                  &l_tCbCtx, &l_uConsumedL) )
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 3  -- FAIL \n");
+    }
+
+    /* All the frame in one call */
+    if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                            &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) )
+    {
+        if( ( sizeof(l_auStuffed) == l_uConsumedL ) && ( 5u == l_tCbCtx.uFrameN ) )
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 4  -- FAIL \n");
+    }
+
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[0u] ) && ( 2u == l_tCbCtx.auFrameL[0u] ) &&
+        ( 0x01u == l_tCbCtx.auFrame[0u][0u] ) && ( 0x02u == l_tCbCtx.auFrame[0u][1u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[1u] ) && ( 2u == l_tCbCtx.auFrameL[1u] ) &&
+        ( ECU_SOF == l_tCbCtx.auFrame[1u][0u] ) && ( 0x05u == l_tCbCtx.auFrame[1u][1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 5  -- FAIL \n");
+    }
+
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == l_tCbCtx.aeFrameRes[2u] ) && ( 0u == l_tCbCtx.auFrameL[2u] ) &&
+        ( e_eCU_BUNSTF_RES_OUTOFMEM == l_tCbCtx.aeFrameRes[3u] ) && ( 8u == l_tCbCtx.auFrameL[3u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[4u] ) && ( 2u == l_tCbCtx.auFrameL[4u] ) &&
+        ( 0x02u == l_tCbCtx.auFrame[4u][0u] ) && ( 0x03u == l_tCbCtx.auFrame[4u][1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 6  -- FAIL \n");
+    }
+
+    /* The last frame is completed by the next chunk */
+    if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffedEnd, sizeof(l_auStuffedEnd),
+                                                            &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) )
+    {
+        if( ( 2u == l_uConsumedL ) && ( 6u == l_tCbCtx.uFrameN ) &&
+            ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[5u] ) && ( 3u == l_tCbCtx.auFrameL[5u] ) &&
+            ( 0xAAu == l_tCbCtx.auFrame[5u][0u] ) && ( 0xCCu == l_tCbCtx.auFrame[5u][2u] ) )
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 7  -- FAIL \n");
+    }
+
+    /* Callback error stop the parsing after the first frame */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = false;
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( e_eCU_BUNSTF_RES_CLBCKREPORTERROR == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                                          &eCU_BUSTFTST_FrameCb, &l_tCbCtx,
+                                                                          &l_uConsumedL) )
+    {
+        if( ( 6u == l_uConsumedL ) && ( 1u == l_tCbCtx.uFrameN ) )
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 8  -- FAIL \n");
+    }
+
+    /* A frame ended using eCU_BUNSTF_InsStufChunk is not reported again */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    (void)eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[2u], 4u, &l_uConsumedL);
+    if( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffedEnd, sizeof(l_auStuffedEnd),
+                                                            &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) )
+    {
+        if( ( 2u == l_uConsumedL ) && ( 0u == l_tCbCtx.uFrameN ) )
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_BUSTFTST_MultiFrame 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_MultiFrame 9  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_OneShot(void)
+{
+    /* Local variable */
+    uint8_t  l_auStuffFrame[] = { ECU_SOF, 0x01u, ECU_ESC, (uint8_t)~ECU_SOF, 0x02u, ECU_ESC, (uint8_t)~ECU_ESC,
+                                  ECU_EOF };
+    uint8_t  l_auStuffFrameNoEof[] = { ECU_SOF, 0x01u, 0x02u };
+    uint8_t  l_auStuffFrameTrail[] = { ECU_SOF, 0x01u, 0x02u, ECU_EOF, 0x03u };
+    uint8_t  l_auStuffFrameNoSof[] = { 0x01u, 0x02u, ECU_EOF };
+    uint8_t  l_auStuffFrameEmpty[] = { ECU_SOF, ECU_EOF };
+    uint8_t  l_auStuffFrameSof[] = { ECU_SOF, 0x01u, ECU_SOF, 0x02u, ECU_EOF };
+    uint8_t  l_auStuffFrameBadEsc[] = { ECU_SOF, 0x01u, ECU_ESC, 0x02u, ECU_EOF };
+    uint8_t  l_auStuffFrameEscEnd[] = { ECU_SOF, 0x01u, ECU_ESC };
+    uint8_t  l_auData[10u];
+    uint32_t l_uDataL;
+
+    /* Function */
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffBuf(NULL, sizeof(l_auStuffFrame), l_auData,
+                                                               sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, sizeof(l_auStuffFrame), l_auData,
+                                                               sizeof(l_auData), NULL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, 0u, l_auData,
+                                                             sizeof(l_auData), &l_uDataL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, sizeof(l_auStuffFrame), l_auData,
+                                                       sizeof(l_auData), &l_uDataL) ) &&
+        ( 4u == l_uDataL ) && ( 0x01u == l_auData[0u] ) && ( ECU_SOF == l_auData[1u] ) &&
+        ( 0x02u == l_auData[2u] ) && ( ECU_ESC == l_auData[3u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 2  -- FAIL \n");
+    }
+
+    /* Function, exact dimension is enough, one less is not, both for raw and escaped data */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, sizeof(l_auStuffFrame), l_auData, 4u,
+                                                       &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_OUTOFMEM == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, sizeof(l_auStuffFrame), l_auData, 3u,
+                                                             &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_OUTOFMEM == eCU_BUNSTF_UnstuffBuf(l_auStuffFrame, sizeof(l_auStuffFrame), l_auData, 2u,
+                                                             &l_uDataL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 3  -- FAIL \n");
+    }
+
+    /* Function, frame without EOF or with trailing data */
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameNoEof, sizeof(l_auStuffFrameNoEof),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameTrail, sizeof(l_auStuffFrameTrail),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 4  -- FAIL \n");
+    }
+
+    /* Function, bad start, empty frame, SOF in frame, bad escape and escape at the end */
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameNoSof, sizeof(l_auStuffFrameNoSof),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameEmpty, sizeof(l_auStuffFrameEmpty),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameSof, sizeof(l_auStuffFrameSof),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameBadEsc, sizeof(l_auStuffFrameBadEsc),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffBuf(l_auStuffFrameEscEnd, sizeof(l_auStuffFrameEscEnd),
+                                                             l_auData, sizeof(l_auData), &l_uDataL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_OneShot 5  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_CrcMode(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[30u];
+    uint8_t  l_auPayload[12u];
+    uint8_t  l_auFrameCrc[12u + ECU_BUNSTF_CRCL];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(12u + ECU_BUNSTF_CRCL)];
+    uint8_t  l_auShort[] = { ECU_SOF, 0x01u, 0x02u, 0x03u, 0x04u, ECU_EOF };
+    uint32_t l_uStuffedL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uCrc;
+    uint32_t l_uIdx;
+    uint8_t* l_puData;
+    e_eCU_BUNSTF_RES l_eRes;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        l_auPayload[l_uIdx] = (uint8_t)( 0x9Eu + l_uIdx );
+    }
+    (void)eCU_CRC_32(l_auPayload, sizeof(l_auPayload), &l_uCrc);
+    (void)memcpy(l_auFrameCrc, l_auPayload, sizeof(l_auPayload));
+    l_auFrameCrc[12u] = (uint8_t)( l_uCrc >> 24u );
+    l_auFrameCrc[13u] = (uint8_t)( l_uCrc >> 16u );
+    l_auFrameCrc[14u] = (uint8_t)( l_uCrc >> 8u );
+    l_auFrameCrc[15u] = (uint8_t)( l_uCrc );
+    (void)eCU_BSTF_StuffBuf(l_auFrameCrc, sizeof(l_auFrameCrc), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SetCrcMode(NULL, true) ) &&
+        ( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_SetCrcMode(&l_tCtx, true) ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 1  -- FAIL \n");
+    }
+
+    /* Function, good frame inserted byte per byte, the CRC is not part of the payload */
+    l_bTestOk = true;
+    if( ( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) ||
+        ( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_SetCrcMode(&l_tCtx, true) ) )
+    {
+        l_bTestOk = false;
+    }
+
+    l_eRes = e_eCU_BUNSTF_RES_OK;
+    for( l_uIdx = 0u; ( l_uIdx < l_uStuffedL ) && ( e_eCU_BUNSTF_RES_OK == l_eRes ); l_uIdx++ )
+    {
+        l_eRes = eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[l_uIdx], 1u, &l_uVarTemp32);
+    }
+
+    if( ( true == l_bTestOk ) && ( e_eCU_BUNSTF_RES_FRAMEENDED == l_eRes ) && ( l_uStuffedL == l_uIdx ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uVarTemp32) ) &&
+        ( sizeof(l_auPayload) == l_uVarTemp32 ) && ( 0 == memcmp(l_auPayload, l_puData, l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 2  -- FAIL \n");
+    }
+
+    /* Function, good frame in a single chunk */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, l_uStuffedL,
+                                                                 &l_uVarTemp32) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) ) &&
+        ( sizeof(l_auPayload) == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 3  -- FAIL \n");
+    }
+
+    /* Function, corrupted payload */
+    l_auStuffed[1u] ^= 0x01u;
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, l_uStuffedL,
+                                                               &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 4  -- FAIL \n");
+    }
+    l_auStuffed[1u] ^= 0x01u;
+
+    /* Function, frame too short to contain a CRC */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auShort, sizeof(l_auShort),
+                                                               &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 5  -- FAIL \n");
+    }
+
+    /* Function, without CRC mode the trailer is part of the payload */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_SetCrcMode(&l_tCtx, false) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, l_uStuffedL,
+                                                                 &l_uVarTemp32) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) ) &&
+        ( sizeof(l_auFrameCrc) == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CrcMode 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_SplitAtSof(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    t_eCU_BUNSTF_FrameCtx l_tCbCtx;
+    uint8_t  l_auMemArea[8u];
+    uint32_t l_uConsumedL;
+    uint32_t l_auSegStart[6u];
+    uint32_t l_uSegIdx;
+    uint32_t l_uSegEnd;
+    bool_t   l_bIsOk;
+    uint8_t  l_auStuffed[] = { 0x55u,
+                               ECU_SOF, 0x01u, 0x02u, ECU_EOF,
+                               ECU_SOF, ECU_ESC, (uint8_t)~ECU_SOF, ECU_EOF,
+                               ECU_SOF, 0x03u, ECU_EOF,
+                               ECU_SOF, 0x04u, 0x05u, 0x06u, ECU_EOF };
+
+    /* Function */
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SplitAtSof(NULL, sizeof(l_auStuffed), l_auSegStart, 4u) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SplitAtSof(l_auStuffed, sizeof(l_auStuffed), NULL, 4u) ) &&
+        ( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_SplitAtSof(l_auStuffed, 0u, l_auSegStart, 4u) ) &&
+        ( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_SplitAtSof(l_auStuffed, sizeof(l_auStuffed), l_auSegStart, 0u) ) )
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 1  -- FAIL \n");
+    }
+
+    /* Function, every segment except the first one start with a SOF */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_SplitAtSof(l_auStuffed, sizeof(l_auStuffed), l_auSegStart, 4u) ) &&
+        ( 0u == l_auSegStart[0u] ) && ( 5u == l_auSegStart[1u] ) && ( 9u == l_auSegStart[2u] ) &&
+        ( 12u == l_auSegStart[3u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 2  -- FAIL \n");
+    }
+
+    /* Function, more segment than SOF, the last ones are empty */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_SplitAtSof(l_auStuffed, sizeof(l_auStuffed), l_auSegStart, 6u) ) &&
+        ( 0u == l_auSegStart[0u] ) && ( 5u == l_auSegStart[1u] ) && ( 9u == l_auSegStart[2u] ) &&
+        ( 12u == l_auSegStart[3u] ) && ( 17u == l_auSegStart[4u] ) && ( 17u == l_auSegStart[5u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 3  -- FAIL \n");
+    }
+
+    /* Function, every segment unstuffed with a different context give the same frames of the whole stream */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    l_bIsOk = true;
+    (void)eCU_BUNSTF_SplitAtSof(l_auStuffed, sizeof(l_auStuffed), l_auSegStart, 4u);
+
+    for( l_uSegIdx = 0u; l_uSegIdx < 4u; l_uSegIdx++ )
+    {
+        l_uSegEnd = ( ( l_uSegIdx + 1u ) < 4u ) ? l_auSegStart[l_uSegIdx + 1u] : sizeof(l_auStuffed);
+        (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+
+        if( ( e_eCU_BUNSTF_RES_OK != eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, &l_auStuffed[l_auSegStart[l_uSegIdx]],
+                                                                  ( l_uSegEnd - l_auSegStart[l_uSegIdx] ),
+                                                                  &eCU_BUSTFTST_FrameCb, &l_tCbCtx,
+                                                                  &l_uConsumedL) ) ||
+            ( ( l_uSegEnd - l_auSegStart[l_uSegIdx] ) != l_uConsumedL ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( 4u == l_tCbCtx.uFrameN ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[0u] ) && ( 2u == l_tCbCtx.auFrameL[0u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[1u] ) && ( 1u == l_tCbCtx.auFrameL[1u] ) &&
+        ( ECU_SOF == l_tCbCtx.auFrame[1u][0u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[2u] ) && ( 0x03u == l_tCbCtx.auFrame[2u][0u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[3u] ) && ( 3u == l_tCbCtx.auFrameL[3u] ) &&
+        ( 0x06u == l_tCbCtx.auFrame[3u][2u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SplitAtSof 4  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_HuntMode(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    t_eCU_BUNSTF_FrameCtx l_tCbCtx;
+    uint8_t  l_auMemArea[8u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uConsumedL;
+    uint32_t l_uSkipL;
+    uint8_t  l_auStuffed[] = { 0x11u, ECU_EOF, ECU_SOF, 0x22u, ECU_EOF };
+    uint8_t  l_auGarbage[] = { 0x33u, ECU_ESC, 0x44u };
+
+    /* Init variable */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_SetHuntMode(NULL, true) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_GetSkippedL(NULL, &l_uSkipL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_GetSkippedL(&l_tCtx, NULL) ) &&
+        ( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_SetHuntMode(&l_tCtx, true) ) &&
+        ( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 1  -- FAIL \n");
+    }
+
+    /* Function, without hunt mode a byte before the SOF is a bad frame */
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                               &l_uConsumedL) ) && ( 1u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) && ( 0u == l_uSkipL ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 2  -- FAIL \n");
+    }
+
+    /* Function, with hunt mode everything before the SOF is skipped in a single call */
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_SetHuntMode(&l_tCtx, true) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                                 &l_uConsumedL) ) && ( 5u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) &&
+        ( 1u == l_uDataL ) && ( 0x22u == l_puData[0u] ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) && ( 2u == l_uSkipL ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 3  -- FAIL \n");
+    }
+
+    /* Function, a chunk without SOF is all consumed, and the counter is incremented */
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auGarbage, sizeof(l_auGarbage), &l_uConsumedL) ) &&
+        ( 3u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) && ( 5u == l_uSkipL ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 4  -- FAIL \n");
+    }
+
+    /* Function, hunt mode doesn't change a frame already started */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[2u], 2u, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auGarbage[1u], 2u, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) && ( 5u == l_uSkipL ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 5  -- FAIL \n");
+    }
+
+    /* Function, byte discharged by the multi frame function are counted too */
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auStuffed, sizeof(l_auStuffed),
+                                                              &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 1u == l_tCbCtx.uFrameN ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetSkippedL(&l_tCtx, &l_uSkipL) ) && ( 2u == l_uSkipL ) )
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_HuntMode 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_CirqIn(void)
+{
+    /* Local variable */
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_tCirq;
+    uint8_t  l_auMemArea[8u];
+    uint8_t  l_auCirqArea[8u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uConsumedL;
+    uint32_t l_uUsedL;
+    uint8_t  l_auStuffed[] = { 0x55u, 0x55u, 0x55u, 0x55u, 0x55u,
+                               ECU_SOF, 0x01u, ECU_ESC, (uint8_t)~ECU_EOF, 0x02u, ECU_EOF, ECU_SOF, 0x03u };
+
+    /* Init variable */
+    l_tCirq.bIsInit = false;
+    l_tCtx.bIsInit = false;
+
+    /* Function, the unstuffer is checked before the queue */
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_InsStufChunkCirq(NULL, &l_tCirq, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, NULL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, NULL) ) &&
+        ( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_BUNSTF_RES_NOINITLIB == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 1  -- FAIL \n");
+    }
+
+    /* Function, empty queue */
+    (void)eCU_CIRQ_InitCtx(&l_tCirq, l_auCirqArea, sizeof(l_auCirqArea));
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) && ( 0u == l_uConsumedL ) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 2  -- FAIL \n");
+    }
+
+    /* Function, a frame that wrap in the queue */
+    (void)eCU_CIRQ_InsertData(&l_tCirq, l_auStuffed, 5u);
+    (void)eCU_CIRQ_RetriveData(&l_tCirq, l_auMemArea, 5u);
+    (void)eCU_CIRQ_InsertData(&l_tCirq, &l_auStuffed[5u], 8u);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) && ( 6u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) &&
+        ( 3u == l_uDataL ) && ( 0x01u == l_puData[0u] ) && ( ECU_EOF == l_puData[1u] ) && ( 0x02u == l_puData[2u] ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSapce(&l_tCirq, &l_uUsedL) ) && ( 2u == l_uUsedL ) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 3  -- FAIL \n");
+    }
+
+    /* Function, data not analized is still in the queue for the next frame */
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) && ( 2u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) &&
+        ( 1u == l_uDataL ) && ( 0x03u == l_puData[0u] ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSapce(&l_tCirq, &l_uUsedL) ) && ( 0u == l_uUsedL ) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 4  -- FAIL \n");
+    }
+
+    /* Function, corrupted unstuffer, the queue is not touched */
+    (void)eCU_CIRQ_InsertData(&l_tCirq, &l_auStuffed[5u], 2u);
+    l_tCtx.uFrameCtr = sizeof(l_auMemArea) + 1u;
+    if( ( e_eCU_BUNSTF_RES_CORRUPTCTX == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSapce(&l_tCirq, &l_uUsedL) ) && ( 2u == l_uUsedL ) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 5  -- FAIL \n");
+    }
+
+    /* Function, corrupted queue */
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCirq.uBuffFreeIdx = sizeof(l_auCirqArea);
+    if( e_eCU_BUNSTF_RES_CORRUPTCTX == eCU_BUNSTF_InsStufChunkCirq(&l_tCtx, &l_tCirq, &l_uConsumedL) )
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_CirqIn 6  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_InPlace(void)
+{
+    /* Local variable */
+    uint8_t  l_auBuf[] = { 0x55u,
+                           ECU_SOF, 0x01u, ECU_ESC, (uint8_t)~ECU_SOF, 0x02u, 0x03u, ECU_ESC, (uint8_t)~ECU_ESC, ECU_EOF,
+                           ECU_SOF, 0x04u, ECU_EOF };
+    uint8_t  l_auNoSof[] = { 0x01u, 0x02u, ECU_EOF };
+    uint8_t  l_auSofIn[] = { ECU_SOF, 0x01u, ECU_SOF, 0x02u, ECU_EOF };
+    uint8_t  l_auEmpty[] = { ECU_SOF, ECU_EOF };
+    uint8_t  l_auNoEof[] = { ECU_SOF, 0x01u };
+    uint8_t  l_auBadEsc[] = { ECU_SOF, 0x01u, ECU_ESC, 0x02u, ECU_EOF };
+    uint8_t  l_auEscEnd[] = { ECU_SOF, 0x01u, ECU_ESC };
+    uint8_t  l_auEscSof[] = { ECU_SOF, 0x01u, ECU_ESC, ECU_SOF, 0x02u, ECU_EOF };
+    uint8_t  l_auPayload[200u];
+    uint8_t  l_auStuffed[ECU_BSTF_MAXSTUFFL(200u)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uDataOff;
+    uint32_t l_uDataL;
+    uint32_t l_uConsumedL;
+    uint32_t l_uIdx;
+
+    /* Function */
+    if( ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffInPlace(NULL, sizeof(l_auBuf), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffInPlace(l_auBuf, sizeof(l_auBuf), NULL, &l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffInPlace(l_auBuf, sizeof(l_auBuf), &l_uDataOff, NULL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPOINTER == eCU_BUNSTF_UnstuffInPlace(l_auBuf, sizeof(l_auBuf), &l_uDataOff, &l_uDataL, NULL) ) &&
+        ( e_eCU_BUNSTF_RES_BADPARAM == eCU_BUNSTF_UnstuffInPlace(l_auBuf, 0u, &l_uDataOff, &l_uDataL, &l_uConsumedL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 1  -- FAIL \n");
+    }
+
+    /* Function, the payload is written over the stuffed frame and the next frame is not touched */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffInPlace(l_auBuf, sizeof(l_auBuf), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 2u == l_uDataOff ) && ( 5u == l_uDataL ) && ( 10u == l_uConsumedL ) &&
+        ( 0x01u == l_auBuf[2u] ) && ( ECU_SOF == l_auBuf[3u] ) && ( 0x02u == l_auBuf[4u] ) && ( 0x03u == l_auBuf[5u] ) &&
+        ( ECU_ESC == l_auBuf[6u] ) && ( ECU_SOF == l_auBuf[10u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 2  -- FAIL \n");
+    }
+
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffInPlace(&l_auBuf[10u], 3u, &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 1u == l_uDataOff ) && ( 1u == l_uDataL ) && ( 3u == l_uConsumedL ) && ( 0x04u == l_auBuf[11u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 3  -- FAIL \n");
+    }
+
+    /* Function, no SOF, and SOF inside a frame that is left for the next call */
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auNoSof, sizeof(l_auNoSof), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 3u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auSofIn, sizeof(l_auSofIn), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 2u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffInPlace(&l_auSofIn[2u], 3u, &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 1u == l_uDataL ) && ( 0x02u == l_auSofIn[3u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 4  -- FAIL \n");
+    }
+
+    /* Function, empty frame, frame without EOF, bad escape and escape at the end */
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auEmpty, sizeof(l_auEmpty), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auNoEof, sizeof(l_auNoEof), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auBadEsc, sizeof(l_auBadEsc), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auEscEnd, sizeof(l_auEscEnd), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 3u == l_uConsumedL ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 5  -- FAIL \n");
+    }
+
+    /* Function, every byte value */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auPayload); l_uIdx++ )
+    {
+        l_auPayload[l_uIdx] = (uint8_t)( ( l_uIdx * 13u ) + 0x9Bu );
+    }
+    (void)eCU_BSTF_StuffBuf(l_auPayload, sizeof(l_auPayload), l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffInPlace(l_auStuffed, l_uStuffedL, &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 1u == l_uDataOff ) && ( sizeof(l_auPayload) == l_uDataL ) && ( l_uStuffedL == l_uConsumedL ) &&
+        ( 0 == memcmp(&l_auStuffed[l_uDataOff], l_auPayload, l_uDataL) ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 6  -- FAIL \n");
+    }
+
+    /* Function, SOF after an escape is left for the next call */
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_UnstuffInPlace(l_auEscSof, sizeof(l_auEscSof), &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 3u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_UnstuffInPlace(&l_auEscSof[3u], 3u, &l_uDataOff, &l_uDataL, &l_uConsumedL) ) &&
+        ( 1u == l_uDataOff ) && ( 1u == l_uDataL ) && ( 3u == l_uConsumedL ) && ( 0x02u == l_auEscSof[4u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_InPlace 7  -- FAIL \n");
+    }
+}
+
+static void eCU_BUSTFTST_SharedFlag(void)
+{
+    /* Local variable */
+    t_eCU_BSTFCFG_Ctx l_tCfg;
+    t_eCU_BUNSTF_Ctx l_tCtx;
+    t_eCU_BUNSTF_FrameCtx l_tCbCtx;
+    uint8_t  l_auMemArea[8u];
+    uint8_t  l_auSmallArea[4u];
+    uint8_t* l_puData;
+    uint32_t l_uConsumedL;
+    uint32_t l_uDataL;
+    uint32_t l_uCrc;
+    uint32_t l_uIdx;
+    uint8_t  l_uCrcByte;
+    uint8_t  l_auCrcFrame[12u];
+    uint8_t  l_auBadCrc[] = { 0x7Eu, 0x61u, 0x62u, 0x63u, 0x64u, 0x65u, 0x7Eu };
+    uint8_t  l_auExact[] = { ECU_SOF, 0x01u, 0x02u, 0x03u, 0x04u };
+    uint8_t  l_auOver[] = { 0x05u, ECU_EOF };
+    uint8_t  l_auHdlc[] = { 0x7Eu, 0x61u, 0x62u, 0x7Eu, 0x63u, 0x64u, 0x7Eu };
+    uint8_t  l_auHdlcDouble[] = { 0x7Eu, 0x61u, 0x7Eu, 0x7Eu, 0x62u, 0x7Eu, 0x7Eu };
+    uint8_t  l_auSlip[] = { 0xC0u, 0x61u, 0x62u, 0xC0u, 0x63u, 0x64u, 0xC0u };
+
+    /* Init variable */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tCtx, &l_tCfg);
+
+    /* Function, a single flag close a frame and open the next one */
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auHdlc, sizeof(l_auHdlc),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( sizeof(l_auHdlc) == l_uConsumedL ) && ( 2u == l_tCbCtx.uFrameN ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[0u] ) && ( 2u == l_tCbCtx.auFrameL[0u] ) &&
+        ( 0x61u == l_tCbCtx.auFrame[0u][0u] ) && ( 0x62u == l_tCbCtx.auFrame[0u][1u] ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == l_tCbCtx.aeFrameRes[1u] ) && ( 2u == l_tCbCtx.auFrameL[1u] ) &&
+        ( 0x63u == l_tCbCtx.auFrame[1u][0u] ) && ( 0x64u == l_tCbCtx.auFrame[1u][1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 1  -- FAIL \n");
+    }
+
+    /* Function, doubled flag between frames are not an empty frame */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auHdlcDouble, sizeof(l_auHdlcDouble),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 2u == l_tCbCtx.uFrameN ) && ( 1u == l_tCbCtx.auFrameL[0u] ) && ( 0x61u == l_tCbCtx.auFrame[0u][0u] ) &&
+        ( 1u == l_tCbCtx.auFrameL[1u] ) && ( 0x62u == l_tCbCtx.auFrame[1u][0u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 2  -- FAIL \n");
+    }
+
+    /* Function, the flag that open the frame is at the end of the previous chunk */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auHdlc, 4u, &eCU_BUSTFTST_FrameCb,
+                                                                &l_tCbCtx, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, &l_auHdlc[4u], 3u, &eCU_BUSTFTST_FrameCb,
+                                                                &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 2u == l_tCbCtx.uFrameN ) && ( 2u == l_tCbCtx.auFrameL[1u] ) && ( 0x63u == l_tCbCtx.auFrame[1u][0u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 3  -- FAIL \n");
+    }
+
+    /* Function, frame ended by eCU_BUNSTF_InsStufChunk and the next one received by eCU_BUNSTF_InsStufChunkMulti */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auHdlc, 4u, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, &l_auHdlc[4u], 3u, &eCU_BUSTFTST_FrameCb,
+                                                                &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 1u == l_tCbCtx.uFrameN ) && ( 2u == l_tCbCtx.auFrameL[0u] ) && ( 0x64u == l_tCbCtx.auFrame[0u][1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 4  -- FAIL \n");
+    }
+
+    /* Function, SLIP */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BSTFCFG_InitSlip(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tCtx, &l_tCfg);
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auSlip, sizeof(l_auSlip),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 2u == l_tCbCtx.uFrameN ) && ( 2u == l_tCbCtx.auFrameL[0u] ) && ( 2u == l_tCbCtx.auFrameL[1u] ) &&
+        ( 0x63u == l_tCbCtx.auFrame[1u][0u] ) && ( 0x64u == l_tCbCtx.auFrame[1u][1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 5  -- FAIL \n");
+    }
+
+    /* Function, default delimiter are different, so the frame after EOF need a new SOF */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_auHdlc[0u] = ECU_SOF;
+    l_auHdlc[3u] = ECU_EOF;
+    l_auHdlc[6u] = ECU_EOF;
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auHdlc, sizeof(l_auHdlc),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( 1u == l_tCbCtx.uFrameN ) && ( 2u == l_tCbCtx.auFrameL[0u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 6  -- FAIL \n");
+    }
+
+    /* Function, back to back HDLC frames received with eCU_BUNSTF_InsStufChunk */
+    l_auHdlc[0u] = 0x7Eu;
+    l_auHdlc[3u] = 0x7Eu;
+    l_auHdlc[6u] = 0x7Eu;
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tCtx, &l_tCfg);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auHdlc, sizeof(l_auHdlc),
+                                                                 &l_uConsumedL) ) &&
+        ( 4u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) && ( 2u == l_uDataL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auHdlc[4u], 3u, &l_uConsumedL) ) &&
+        ( 3u == l_uConsumedL ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) && ( 2u == l_uDataL ) &&
+        ( 0x63u == l_puData[0u] ) && ( 0x64u == l_puData[1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 7  -- FAIL \n");
+    }
+
+    /* Function, back to back SLIP frames received with eCU_BUNSTF_InsStufChunk */
+    (void)eCU_BSTFCFG_InitSlip(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tCtx, &l_tCfg);
+    if( ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auSlip, sizeof(l_auSlip),
+                                                                 &l_uConsumedL) ) &&
+        ( 4u == l_uConsumedL ) && ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, &l_auSlip[4u], 3u, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) && ( 2u == l_uDataL ) &&
+        ( 0x63u == l_puData[0u] ) && ( 0x64u == l_puData[1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 8  -- FAIL \n");
+    }
+
+    /* Function, a frame with a bad CRC don't lose the frame that follow it */
+    (void)eCU_CRC_32(&l_auHdlc[1u], 2u, &l_uCrc);
+    l_auCrcFrame[0u] = 0x61u;
+    l_auCrcFrame[1u] = 0x62u;
+    l_uDataL = 2u;
+    for( l_uIdx = 0u; l_uIdx < 4u; l_uIdx++ )
+    {
+        l_uCrcByte = (uint8_t)( l_uCrc >> ( 24u - ( 8u * l_uIdx ) ) );
+        if( ( 0x7Eu == l_uCrcByte ) || ( 0x7Du == l_uCrcByte ) )
+        {
+            l_auCrcFrame[l_uDataL] = 0x7Du;
+            l_uDataL++;
+            l_uCrcByte ^= 0x20u;
+        }
+        l_auCrcFrame[l_uDataL] = l_uCrcByte;
+        l_uDataL++;
+    }
+    l_auCrcFrame[l_uDataL] = 0x7Eu;
+    l_uDataL++;
+    (void)eCU_BSTFCFG_InitHdlc(&l_tCfg);
+    (void)eCU_BUNSTF_SetCfg(&l_tCtx, &l_tCfg);
+    (void)eCU_BUNSTF_SetCrcMode(&l_tCtx, true);
+    if( ( e_eCU_BUNSTF_RES_BADFRAME == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auBadCrc, sizeof(l_auBadCrc),
+                                                               &l_uConsumedL) ) &&
+        ( sizeof(l_auBadCrc) == l_uConsumedL ) && ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_NewFrame(&l_tCtx) ) &&
+        ( e_eCU_BUNSTF_RES_FRAMEENDED == eCU_BUNSTF_InsStufChunk(&l_tCtx, l_auCrcFrame, l_uDataL, &l_uConsumedL) ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_GetUnstufData(&l_tCtx, &l_puData, &l_uDataL) ) && ( 2u == l_uDataL ) &&
+        ( 0x61u == l_puData[0u] ) && ( 0x62u == l_puData[1u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 9  -- FAIL \n");
+    }
+
+    /* Function, frame that fill the memory at the end of a chunk and go out of memory at the start of the next */
+    (void)memset(&l_tCbCtx, 0, sizeof(l_tCbCtx));
+    l_tCbCtx.bRetVal = true;
+    (void)eCU_BUNSTF_InitCtx(&l_tCtx, l_auSmallArea, sizeof(l_auSmallArea));
+    if( ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auExact, sizeof(l_auExact),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( sizeof(l_auExact) == l_uConsumedL ) && ( 0u == l_tCbCtx.uFrameN ) &&
+        ( e_eCU_BUNSTF_RES_OK == eCU_BUNSTF_InsStufChunkMulti(&l_tCtx, l_auOver, sizeof(l_auOver),
+                                                                &eCU_BUSTFTST_FrameCb, &l_tCbCtx, &l_uConsumedL) ) &&
+        ( sizeof(l_auOver) == l_uConsumedL ) && ( 1u == l_tCbCtx.uFrameN ) &&
+        ( e_eCU_BUNSTF_RES_OUTOFMEM == l_tCbCtx.aeFrameRes[0u] ) )
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_BUSTFTST_SharedFlag 10 -- FAIL \n");
+    }
 }
\ No newline at end of file
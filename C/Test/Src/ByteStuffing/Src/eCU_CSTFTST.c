@@ -0,0 +1,737 @@
+/**
+ * @file       eCU_CSTFTST.c
+ *
+ * @brief      COBS byte stuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CSTFTST.h"
+#include "eCU_CSTF.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_CSTFTST_BadPointer(void);
+static void eCU_CSTFTST_BadInit(void);
+static void eCU_CSTFTST_BadParamEntr(void);
+static void eCU_CSTFTST_CorrupterContext(void);
+static void eCU_CSTFTST_KnownVector(void);
+static void eCU_CSTFTST_ChunkRestart(void);
+static void eCU_CSTFTST_Overhead(void);
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_CSTFTST_ExeTest(void)
+{
+	(void)printf("\n\nCOBS BYTE STUFFER TEST START \n\n");
+
+    eCU_CSTFTST_BadPointer();
+    eCU_CSTFTST_BadInit();
+    eCU_CSTFTST_BadParamEntr();
+    eCU_CSTFTST_CorrupterContext();
+    eCU_CSTFTST_KnownVector();
+    eCU_CSTFTST_ChunkRestart();
+    eCU_CSTFTST_Overhead();
+
+    (void)printf("\n\nCOBS BYTE STUFFER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_CSTFTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_InitCtx(NULL, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_InitCtx(&l_tCtx, NULL, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetWherePutData(NULL, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetWherePutData(&l_tCtx, NULL, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetWherePutData(&l_tCtx, &l_puPointer, NULL) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_NewFrame(NULL, 2u) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_RestartFrame(NULL) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetRemByteToGet(NULL, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetRemByteToGet(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetStufChunk(NULL, l_auMemArea, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetStufChunk(&l_tCtx, NULL, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPOINTER == eCU_CSTF_GetStufChunk(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), NULL) )
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadPointer 14 -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_CSTF_RES_NOINITLIB == eCU_CSTF_GetWherePutData(&l_tCtx, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_NOINITLIB == eCU_CSTF_NewFrame(&l_tCtx, 2u) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_NOINITLIB == eCU_CSTF_RestartFrame(&l_tCtx) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_NOINITLIB == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_NOINITLIB == eCU_CSTF_GetStufChunk(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eCU_CSTFTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadInit 6  -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auStuffed[10u];
+    uint32_t l_uVarTemp32;
+
+    /* Function */
+    if( e_eCU_CSTF_RES_BADPARAM == eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, 0u) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_OK == eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    /* Function, frame not started */
+    if( ( e_eCU_CSTF_RES_NOINITFRAME == eCU_CSTF_RestartFrame(&l_tCtx) ) &&
+        ( e_eCU_CSTF_RES_NOINITFRAME == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) ) &&
+        ( e_eCU_CSTF_RES_NOINITFRAME == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPARAM == eCU_CSTF_NewFrame(&l_tCtx, 0u) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CSTF_RES_BADPARAM == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea) + 1u) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_CSTF_RES_BADPARAM == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, 0u, &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_BadParamEntr 6  -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_CorrupterContext(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auStuffed[10u];
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.puBuff = NULL;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_NewFrame(&l_tCtx, 2u) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.uBuffL = 0u;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_RestartFrame(&l_tCtx) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.uFrameL = sizeof(l_auMemArea) + 1u;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 3  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.uFrameCtr = 4u;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 4  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.uBlockRem = 1u;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 5  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.eSM = e_eCU_CSTFPRV_SM_STUFFEND;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_GetWherePutData(&l_tCtx, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 6  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_NewFrame(&l_tCtx, 3u);
+    l_tCtx.eSM = (e_eCU_CSTFPRV_SM)10u;
+    if( e_eCU_CSTF_RES_CORRUPTCTX == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_CorrupterContext 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_KnownVector(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auStuffed[ECU_CSTF_MAXSTUFFL(300u)];
+    uint32_t l_uRemL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uIdx;
+    uint8_t* l_puPointer;
+    uint8_t  l_auData1[] = { 0x00u };
+    uint8_t  l_auExp1[] = { 0x01u, 0x01u, 0x00u };
+    uint8_t  l_auData2[] = { 0x00u, 0x00u };
+    uint8_t  l_auExp2[] = { 0x01u, 0x01u, 0x01u, 0x00u };
+    uint8_t  l_auData3[] = { 0x00u, 0x11u, 0x00u };
+    uint8_t  l_auExp3[] = { 0x01u, 0x02u, 0x11u, 0x01u, 0x00u };
+    uint8_t  l_auData4[] = { 0x11u, 0x22u, 0x00u, 0x33u };
+    uint8_t  l_auExp4[] = { 0x03u, 0x11u, 0x22u, 0x02u, 0x33u, 0x00u };
+    uint8_t  l_auData5[] = { 0x11u, 0x22u, 0x33u, 0x44u };
+    uint8_t  l_auExp5[] = { 0x05u, 0x11u, 0x22u, 0x33u, 0x44u, 0x00u };
+    uint8_t  l_auData6[] = { 0x11u, 0x00u, 0x00u, 0x00u };
+    uint8_t  l_auExp6[] = { 0x02u, 0x11u, 0x01u, 0x01u, 0x01u, 0x00u };
+
+    /* Init variable */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eCU_CSTF_GetWherePutData(&l_tCtx, &l_puPointer, &l_uVarTemp32);
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData1, sizeof(l_auData1));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData1)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp1) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp1) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp1, sizeof(l_auExp1)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData2, sizeof(l_auData2));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData2)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp2) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp2) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp2, sizeof(l_auExp2)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData3, sizeof(l_auData3));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData3)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp3) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp3) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp3, sizeof(l_auExp3)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 3  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData4, sizeof(l_auData4));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData4)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp4) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp4) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp4, sizeof(l_auExp4)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 4  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData5, sizeof(l_auData5));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData5)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp5) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp5) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp5, sizeof(l_auExp5)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 5  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)memcpy(l_puPointer, l_auData6, sizeof(l_auData6));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auData6)) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( sizeof(l_auExp6) == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( sizeof(l_auExp6) == l_uVarTemp32 ) && ( 0 == memcmp(l_auStuffed, l_auExp6, sizeof(l_auExp6)) ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 6  -- FAIL \n");
+    }
+
+    /* Function, a block of 254 non zero byte doesn't need another block */
+    for( l_uIdx = 0u; l_uIdx < 254u; l_uIdx++ )
+    {
+        l_puPointer[l_uIdx] = (uint8_t)( l_uIdx + 1u );
+    }
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, 254u) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( 256u == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( 256u == l_uVarTemp32 ) && ( 0xFFu == l_auStuffed[0u] ) && ( 0 == memcmp(&l_auStuffed[1u], l_puPointer, 254u) ) &&
+        ( 0x00u == l_auStuffed[255u] ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 7  -- FAIL \n");
+    }
+
+    /* Function, a zero before the full block */
+    for( l_uIdx = 0u; l_uIdx < 255u; l_uIdx++ )
+    {
+        l_puPointer[l_uIdx] = (uint8_t)l_uIdx;
+    }
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, 255u) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( 257u == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( 257u == l_uVarTemp32 ) && ( 0x01u == l_auStuffed[0u] ) && ( 0xFFu == l_auStuffed[1u] ) &&
+        ( 0 == memcmp(&l_auStuffed[2u], &l_puPointer[1u], 254u) ) && ( 0x00u == l_auStuffed[256u] ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 8  -- FAIL \n");
+    }
+
+    /* Function, the byte after a full block start a new block */
+    for( l_uIdx = 0u; l_uIdx < 255u; l_uIdx++ )
+    {
+        l_puPointer[l_uIdx] = (uint8_t)( l_uIdx + 1u );
+    }
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, 255u) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( 258u == l_uRemL ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( 258u == l_uVarTemp32 ) && ( 0xFFu == l_auStuffed[0u] ) && ( 0 == memcmp(&l_auStuffed[1u], l_puPointer, 254u) ) &&
+        ( 0x02u == l_auStuffed[255u] ) && ( 0xFFu == l_auStuffed[256u] ) && ( 0x00u == l_auStuffed[257u] ) )
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_KnownVector 9  -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_ChunkRestart(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[600u];
+    uint8_t  l_auStuffed[ECU_CSTF_MAXSTUFFL(600u)];
+    uint8_t  l_auStuffedChunk[ECU_CSTF_MAXSTUFFL(600u)];
+    uint32_t l_uStuffedL;
+    uint32_t l_uChunkL;
+    uint32_t l_uRemL;
+    uint32_t l_uVarTemp32;
+    uint32_t l_uIdx;
+    bool_t   l_bIsCoherent;
+    e_eCU_CSTF_RES l_eRes;
+
+    /* Init variable, long run of non zero byte and some zero */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMemArea); l_uIdx++ )
+    {
+        l_auMemArea[l_uIdx] = (uint8_t)( ( l_uIdx % 251u ) + 1u );
+    }
+    l_auMemArea[0u] = 0x00u;
+    l_auMemArea[300u] = 0x00u;
+    l_auMemArea[301u] = 0x00u;
+    l_auMemArea[599u] = 0x00u;
+
+    /* Function, stuff all in one time */
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uStuffedL) ) &&
+        ( l_uStuffedL <= ECU_CSTF_MAXSTUFFL(600u) ) && ( 0x00u == l_auStuffed[l_uStuffedL - 1u] ) &&
+        ( NULL == memchr(l_auStuffed, 0x00, l_uStuffedL - 1u) ) )
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 1  -- FAIL \n");
+    }
+
+    /* Function, every chunk dimension must generate the same frame, and remaining byte must be coherent */
+    l_bIsCoherent = true;
+    for( l_uChunkL = 1u; l_uChunkL < 260u; l_uChunkL += 7u )
+    {
+        (void)memset(l_auStuffedChunk, 0xFF, sizeof(l_auStuffedChunk));
+        (void)eCU_CSTF_RestartFrame(&l_tCtx);
+        l_uIdx = 0u;
+        l_eRes = e_eCU_CSTF_RES_OK;
+
+        while( ( e_eCU_CSTF_RES_OK == l_eRes ) && ( true == l_bIsCoherent ) )
+        {
+            if( ( e_eCU_CSTF_RES_OK != eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) ||
+                ( ( l_uIdx + l_uRemL ) != l_uStuffedL ) )
+            {
+                l_bIsCoherent = false;
+            }
+            else
+            {
+                l_eRes = eCU_CSTF_GetStufChunk(&l_tCtx, &l_auStuffedChunk[l_uIdx], l_uChunkL, &l_uVarTemp32);
+                l_uIdx += l_uVarTemp32;
+            }
+        }
+
+        if( ( e_eCU_CSTF_RES_FRAMEENDED != l_eRes ) || ( l_uIdx != l_uStuffedL ) ||
+            ( 0 != memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+        {
+            l_bIsCoherent = false;
+        }
+    }
+    if( true == l_bIsCoherent )
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 2  -- FAIL \n");
+    }
+
+    /* Function, restart in the middle of a block */
+    (void)eCU_CSTF_RestartFrame(&l_tCtx);
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, 100u, &l_uVarTemp32) ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_RestartFrame(&l_tCtx) ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) &&
+        ( l_uVarTemp32 == l_uStuffedL ) && ( 0 == memcmp(l_auStuffed, l_auStuffedChunk, l_uStuffedL) ) )
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 3  -- FAIL \n");
+    }
+
+    /* Function, nothing more after the end */
+    if( ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffedChunk, sizeof(l_auStuffedChunk),
+                                                             &l_uVarTemp32) ) && ( 0u == l_uVarTemp32 ) &&
+        ( e_eCU_CSTF_RES_OK == eCU_CSTF_GetRemByteToGet(&l_tCtx, &l_uRemL) ) && ( 0u == l_uRemL ) )
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_ChunkRestart 4  -- FAIL \n");
+    }
+}
+
+static void eCU_CSTFTST_Overhead(void)
+{
+    /* Local variable */
+    t_eCU_CSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[1000u];
+    uint8_t  l_auStuffed[ECU_CSTF_MAXSTUFFL(1000u)];
+    uint32_t l_uVarTemp32;
+
+    /* Function, without zero the overhead is one byte every 254 byte plus the end of frame */
+    (void)memset(l_auMemArea, 0xA5, sizeof(l_auMemArea));
+    (void)eCU_CSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( ECU_CSTF_MAXSTUFFL(1000u) == l_uVarTemp32 ) && ( 1005u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CSTFTST_Overhead 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_Overhead 1  -- FAIL \n");
+    }
+
+    /* Function, with only zero every zero is replaced by a code */
+    (void)memset(l_auMemArea, 0x00, sizeof(l_auMemArea));
+    if( ( e_eCU_CSTF_RES_OK == eCU_CSTF_NewFrame(&l_tCtx, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_CSTF_RES_FRAMEENDED == eCU_CSTF_GetStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) ) &&
+        ( 1002u == l_uVarTemp32 ) && ( 0x01u == l_auStuffed[500u] ) && ( 0x00u == l_auStuffed[1001u] ) )
+    {
+        (void)printf("eCU_CSTFTST_Overhead 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CSTFTST_Overhead 2  -- FAIL \n");
+    }
+}
\ No newline at end of file
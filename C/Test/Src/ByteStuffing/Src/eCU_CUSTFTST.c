@@ -0,0 +1,717 @@
+/**
+ * @file       eCU_CUSTFTST.c
+ *
+ * @brief      COBS byte unstuffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CUSTFTST.h"
+#include "eCU_CUNSTF.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_CUSTFTST_BadPointer(void);
+static void eCU_CUSTFTST_BadInit(void);
+static void eCU_CUSTFTST_BadParamEntr(void);
+static void eCU_CUSTFTST_CorrupterContext(void);
+static void eCU_CUSTFTST_KnownVector(void);
+static void eCU_CUSTFTST_BadFrame(void);
+static void eCU_CUSTFTST_OutOfMem(void);
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_CUSTFTST_ExeTest(void)
+{
+	(void)printf("\n\nCOBS BYTE UNSTUFFER TEST START \n\n");
+
+    eCU_CUSTFTST_BadPointer();
+    eCU_CUSTFTST_BadInit();
+    eCU_CUSTFTST_BadParamEntr();
+    eCU_CUSTFTST_CorrupterContext();
+    eCU_CUSTFTST_KnownVector();
+    eCU_CUSTFTST_BadFrame();
+    eCU_CUSTFTST_OutOfMem();
+
+    (void)printf("\n\nCOBS BYTE UNSTUFFER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_CUSTFTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_InitCtx(NULL, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_InitCtx(&l_tCtx, NULL, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_NewFrame(NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_GetUnstufData(NULL, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_GetUnstufData(&l_tCtx, NULL, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_GetUnstufLen(NULL, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_GetUnstufLen(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsAFullFrameUnstuff(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsFrameBad(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_IsFrameBad(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_InsStufChunk(NULL, l_auMemArea, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_InsStufChunk(&l_tCtx, NULL, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_BADPOINTER == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), NULL) )
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadPointer 17 -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_NewFrame(&l_tCtx) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsInit) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_IsFrameBad(&l_tCtx, &l_bIsInit) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CUNSTF_RES_NOINITLIB == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadInit 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint32_t l_uVarTemp32;
+
+    /* Function */
+    if( e_eCU_CUNSTF_RES_BADPARAM == eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, 0u) )
+    {
+        (void)printf("eCU_CUSTFTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) ) &&
+        ( e_eCU_CUNSTF_RES_BADPARAM == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auMemArea, 0u, &l_uVarTemp32) ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadParamEntr 2  -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_CorrupterContext(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auStuffed[] = { 0x03u, 0x11u, 0x22u, 0x00u };
+    uint32_t l_uVarTemp32;
+    uint8_t* l_puPointer;
+    bool_t   l_bIsBad;
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.puBuff = NULL;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_NewFrame(&l_tCtx) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uFrameCtr = sizeof(l_auMemArea) + 1u;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uBlockRem = 1u;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 3  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.eSM = e_eCU_CUNSTFPRV_SM_NEEDDATA;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_IsFrameBad(&l_tCtx, &l_bIsBad) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 4  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.eSM = e_eCU_CUNSTFPRV_SM_UNSTUFFEND;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsBad) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 5  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uBlockRem = 300u;
+    l_tCtx.eSM = e_eCU_CUNSTFPRV_SM_NEEDDATA;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 6  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.eSM = (e_eCU_CUNSTFPRV_SM)10u;
+    if( e_eCU_CUNSTF_RES_CORRUPTCTX == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuffed, sizeof(l_auStuffed), &l_uVarTemp32) )
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_CorrupterContext 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_KnownVector(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auStuffed[300u];
+    uint32_t l_uVarTemp32;
+    uint32_t l_uIdx;
+    uint8_t* l_puPointer;
+    uint32_t l_uDataL;
+    bool_t   l_bIsEnded;
+    uint8_t  l_auData1[] = { 0x00u };
+    uint8_t  l_auStuf1[] = { 0x01u, 0x01u, 0x00u };
+    uint8_t  l_auData2[] = { 0x00u, 0x00u };
+    uint8_t  l_auStuf2[] = { 0x01u, 0x01u, 0x01u, 0x00u };
+    uint8_t  l_auData3[] = { 0x00u, 0x11u, 0x00u };
+    uint8_t  l_auStuf3[] = { 0x01u, 0x02u, 0x11u, 0x01u, 0x00u };
+    uint8_t  l_auData4[] = { 0x11u, 0x22u, 0x00u, 0x33u };
+    uint8_t  l_auStuf4[] = { 0x03u, 0x11u, 0x22u, 0x02u, 0x33u, 0x00u };
+    uint8_t  l_auData5[] = { 0x11u, 0x22u, 0x33u, 0x44u };
+    uint8_t  l_auStuf5[] = { 0x05u, 0x11u, 0x22u, 0x33u, 0x44u, 0x00u };
+    uint8_t  l_auData6[] = { 0x11u, 0x00u, 0x00u, 0x00u };
+    uint8_t  l_auStuf6[] = { 0x02u, 0x11u, 0x01u, 0x01u, 0x01u, 0x00u };
+
+    /* Init variable */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf1, sizeof(l_auStuf1),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf1) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData1) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData1, sizeof(l_auData1)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf2, sizeof(l_auStuf2),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf2) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData2) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData2, sizeof(l_auData2)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf3, sizeof(l_auStuf3),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf3) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData3) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData3, sizeof(l_auData3)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 3  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf4, sizeof(l_auStuf4),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf4) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData4) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData4, sizeof(l_auData4)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 4  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf5, sizeof(l_auStuf5),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf5) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData5) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData5, sizeof(l_auData5)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 5  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auStuf6, sizeof(l_auStuf6),
+                                                                 &l_uVarTemp32) ) && ( sizeof(l_auStuf6) == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) &&
+        ( sizeof(l_auData6) == l_uDataL ) && ( 0 == memcmp(l_puPointer, l_auData6, sizeof(l_auData6)) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsAFullFrameUnstuff(&l_tCtx, &l_bIsEnded) ) && ( true == l_bIsEnded ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 6  -- FAIL \n");
+    }
+
+    /* Function, a full block followed by a block of one byte, inserted one byte at a time */
+    l_auStuffed[0u] = 0xFFu;
+    for( l_uIdx = 1u; l_uIdx < 255u; l_uIdx++ )
+    {
+        l_auStuffed[l_uIdx] = (uint8_t)l_uIdx;
+    }
+    l_auStuffed[255u] = 0x02u;
+    l_auStuffed[256u] = 0xFFu;
+    l_auStuffed[257u] = 0x00u;
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    l_uIdx = 0u;
+    while( ( l_uIdx < 257u ) &&
+           ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[l_uIdx], 1u, &l_uVarTemp32) ) )
+    {
+        l_uIdx++;
+    }
+    if( ( 257u == l_uIdx ) &&
+        ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, &l_auStuffed[257u], 1u, &l_uVarTemp32) ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufData(&l_tCtx, &l_puPointer, &l_uDataL) ) && ( 255u == l_uDataL ) &&
+        ( 0 == memcmp(l_puPointer, &l_auStuffed[1u], 254u) ) && ( 0xFFu == l_puPointer[254u] ) )
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_KnownVector 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_BadFrame(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[10u];
+    uint32_t l_uVarTemp32;
+    bool_t   l_bIsBad;
+    uint8_t  l_auEmpty[] = { 0x00u };
+    uint8_t  l_auEmptyBlock[] = { 0x01u, 0x00u };
+    uint8_t  l_auTruncated[] = { 0x04u, 0x11u, 0x22u, 0x00u, 0x02u, 0x33u, 0x00u };
+    uint8_t  l_auTwoFrame[] = { 0x02u, 0x11u, 0x00u, 0x02u, 0x22u, 0x00u };
+
+    /* Init variable */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+
+    /* Function, empty frame */
+    if( ( e_eCU_CUNSTF_RES_BADFRAME == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auEmpty, sizeof(l_auEmpty), &l_uVarTemp32) ) &&
+        ( 1u == l_uVarTemp32 ) && ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsFrameBad(&l_tCtx, &l_bIsBad) ) && ( true == l_bIsBad ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 1  -- FAIL \n");
+    }
+
+    /* Function, nothing can be parsed until a new frame is started */
+    if( ( e_eCU_CUNSTF_RES_BADFRAME == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auTwoFrame, sizeof(l_auTwoFrame),
+                                                               &l_uVarTemp32) ) && ( 0u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 2  -- FAIL \n");
+    }
+
+    /* Function, block without data and without a following block */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_BADFRAME == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auEmptyBlock, sizeof(l_auEmptyBlock),
+                                                               &l_uVarTemp32) ) && ( 2u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 3  -- FAIL \n");
+    }
+
+    /* Function, end of frame in the middle of a block */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_BADFRAME == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auTruncated, sizeof(l_auTruncated),
+                                                               &l_uVarTemp32) ) && ( 4u == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsFrameBad(&l_tCtx, &l_bIsBad) ) && ( true == l_bIsBad ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 4  -- FAIL \n");
+    }
+
+    /* Function, after a good frame the remaining data are not parsed */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auTwoFrame, sizeof(l_auTwoFrame),
+                                                                 &l_uVarTemp32) ) && ( 3u == l_uVarTemp32 ) &&
+        ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, &l_auTwoFrame[3u], 3u, &l_uVarTemp32) ) &&
+        ( 0u == l_uVarTemp32 ) && ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_IsFrameBad(&l_tCtx, &l_bIsBad) ) &&
+        ( false == l_bIsBad ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 5  -- FAIL \n");
+    }
+
+    /* Function, second frame */
+    (void)eCU_CUNSTF_NewFrame(&l_tCtx);
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, &l_auTwoFrame[3u], 3u, &l_uVarTemp32) ) &&
+        ( 3u == l_uVarTemp32 ) && ( 0x22u == l_auMemArea[0u] ) &&
+        ( e_eCU_CUNSTF_RES_OK == eCU_CUNSTF_GetUnstufLen(&l_tCtx, &l_uVarTemp32) ) && ( 1u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_BadFrame 6  -- FAIL \n");
+    }
+}
+
+static void eCU_CUSTFTST_OutOfMem(void)
+{
+    /* Local variable */
+    t_eCU_CUNSTF_Ctx l_tCtx;
+    uint8_t  l_auMemArea[3u];
+    uint32_t l_uVarTemp32;
+    uint8_t  l_auBlock[] = { 0x05u, 0x11u, 0x22u, 0x33u, 0x44u, 0x00u };
+    uint8_t  l_auZero[] = { 0x02u, 0x11u, 0x02u, 0x22u, 0x02u, 0x33u, 0x00u };
+    uint8_t  l_auFit[] = { 0x02u, 0x11u, 0x02u, 0x22u, 0x00u };
+
+    /* Function, block bigger than memory */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_CUNSTF_RES_OUTOFMEM == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auBlock, sizeof(l_auBlock), &l_uVarTemp32) ) &&
+        ( 4u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 1  -- FAIL \n");
+    }
+
+    /* Function, data fit but not the implicit zero */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, 2u);
+    if( ( e_eCU_CUNSTF_RES_OUTOFMEM == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auZero, sizeof(l_auZero), &l_uVarTemp32) ) &&
+        ( 3u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 2  -- FAIL \n");
+    }
+
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, 1u);
+    if( ( e_eCU_CUNSTF_RES_OUTOFMEM == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auZero, sizeof(l_auZero), &l_uVarTemp32) ) &&
+        ( 2u == l_uVarTemp32 ) )
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 3  -- FAIL \n");
+    }
+
+    /* Function, exact dimension is enough */
+    (void)eCU_CUNSTF_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    if( ( e_eCU_CUNSTF_RES_FRAMEENDED == eCU_CUNSTF_InsStufChunk(&l_tCtx, l_auFit, sizeof(l_auFit), &l_uVarTemp32) ) &&
+        ( sizeof(l_auFit) == l_uVarTemp32 ) && ( 0x11u == l_auMemArea[0u] ) && ( 0x00u == l_auMemArea[1u] ) &&
+        ( 0x22u == l_auMemArea[2u] ) )
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CUSTFTST_OutOfMem 4  -- FAIL \n");
+    }
+}
\ No newline at end of file
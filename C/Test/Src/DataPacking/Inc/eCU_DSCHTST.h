@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_DSCHTST.h
+ *
+ * @brief      Data schema test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_DSCHTST_H
+#define ECU_DSCHTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the data schema module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_DSCHTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_DSCHTST_H */
\ No newline at end of file
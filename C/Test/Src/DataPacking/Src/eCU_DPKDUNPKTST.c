@@ -13,6 +13,8 @@
 #include "eCU_DPKDUNPKTST.h"
 #include "eCU_DPK.h"
 #include "eCU_DUNPK.h"
+#include "eCU_DPKREC.h"
+#include "eCU_DUNPKREC.h"
 #include <stdio.h>
 
 
@@ -23,6 +25,9 @@
 static void eCU_DPKDUNPKTST_LE(void);
 static void eCU_DPKDUNPKTST_BE(void);
 static void eCU_DPKDUNPKTST_General(void);
+static void eCU_DPKDUNPKTST_Record(void);
+static void eCU_DPKDUNPKTST_ArrayElem(void);
+static void eCU_DPKDUNPKTST_VarInt(void);
 
 
 
@@ -36,6 +41,9 @@ void eCU_DPKDUNPKTST_ExeTest(void)
     eCU_DPKDUNPKTST_LE();
     eCU_DPKDUNPKTST_BE();
     eCU_DPKDUNPKTST_General();
+    eCU_DPKDUNPKTST_Record();
+    eCU_DPKDUNPKTST_ArrayElem();
+    eCU_DPKDUNPKTST_VarInt();
 
     (void)printf("\n\nDATA PACK UNPACK END \n\n");
 }
@@ -576,4 +584,489 @@ static void eCU_DPKDUNPKTST_General(void)
     {
         (void)printf("eCU_DPKDUNPKTST_General 8  -- FAIL \n");
     }
+}
+
+static void eCU_DPKDUNPKTST_Record(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    t_eCU_DPK_Rec l_tRec;
+    t_eCU_DUNPK_Rec l_tURec;
+    uint8_t l_auMemPack[20u];
+    uint8_t l_auMemExpected[20u];
+    uint8_t* l_puPacked;
+    uint32_t l_uPackedL;
+    uint32_t l_uRemL;
+    uint8_t l_uVar8;
+    uint16_t l_uVar16;
+    uint32_t l_uVar32;
+    uint64_t l_uVar64;
+    bool_t l_bIsLE;
+    bool_t l_bRes;
+
+    /* Init variable */
+    l_tCtxPack.bIsInit = false;
+    l_tCtxUnPack.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_ReserveRec(NULL, 15u, &l_tRec) ) &&
+        ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_ReserveRec(&l_tCtxPack, 15u, NULL) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_GetRec(NULL, 15u, &l_tURec) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_GetRec(&l_tCtxUnPack, 15u, NULL) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 1  -- FAIL \n");
+    }
+    if( ( e_eCU_DPK_RES_NOINITLIB == eCU_DPK_ReserveRec(&l_tCtxPack, 15u, &l_tRec) ) &&
+        ( e_eCU_DUNPK_RES_NOINITLIB == eCU_DUNPK_GetRec(&l_tCtxUnPack, 15u, &l_tURec) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), true);
+    if( ( e_eCU_DPK_RES_BADPARAM == eCU_DPK_ReserveRec(&l_tCtxPack, 0u, &l_tRec) ) &&
+        ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_ReserveRec(&l_tCtxPack, 21u, &l_tRec) ) &&
+        ( e_eCU_DUNPK_RES_NOINITFRAME == eCU_DUNPK_GetRec(&l_tCtxUnPack, 15u, &l_tURec) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 3  -- FAIL \n");
+    }
+
+    /* Function, a record must give the same data of the single push, in both endianness */
+    l_bIsLE = true;
+    l_bRes = true;
+    while( true == l_bRes )
+    {
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemExpected, sizeof(l_auMemExpected), l_bIsLE);
+        (void)eCU_DPK_PushU8(&l_tCtxPack, 0x12u);
+        (void)eCU_DPK_PushU16(&l_tCtxPack, 0x3456u);
+        (void)eCU_DPK_PushU32(&l_tCtxPack, 0x789ABCDEu);
+        (void)eCU_DPK_PushU64(&l_tCtxPack, 0x0123456789ABCDEFuLL);
+
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), l_bIsLE);
+        (void)eCU_DPK_PushU8(&l_tCtxPack, 0x00u);
+        (void)eCU_DPK_StartNewPack(&l_tCtxPack);
+        l_bRes = ( e_eCU_DPK_RES_OK == eCU_DPK_ReserveRec(&l_tCtxPack, 15u, &l_tRec) );
+        l_uRemL = eCU_DPKREC_GetRemL(&l_tRec);
+        eCU_DPKREC_PushU8(&l_tRec, 0x12u);
+        eCU_DPKREC_PushU16(&l_tRec, 0x3456u);
+        eCU_DPKREC_PushU32(&l_tRec, 0x789ABCDEu);
+        eCU_DPKREC_PushU64(&l_tRec, 0x0123456789ABCDEFuLL);
+        l_bRes = l_bRes && ( 15u == l_uRemL ) && ( 0u == eCU_DPKREC_GetRemL(&l_tRec) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) );
+        l_bRes = l_bRes && ( 15u == l_uPackedL ) && ( 0 == memcmp(l_puPacked, l_auMemExpected, l_uPackedL) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_ReserveRec(&l_tCtxPack, 6u, &l_tRec) );
+
+        /* Read back the record */
+        (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), l_bIsLE);
+        (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 16u);
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_GetRec(&l_tCtxUnPack, 15u, &l_tURec) );
+        l_uRemL = eCU_DUNPKREC_GetRemL(&l_tURec);
+        l_uVar8 = eCU_DUNPKREC_PopU8(&l_tURec);
+        l_uVar16 = eCU_DUNPKREC_PopU16(&l_tURec);
+        l_uVar32 = eCU_DUNPKREC_PopU32(&l_tURec);
+        l_uVar64 = eCU_DUNPKREC_PopU64(&l_tURec);
+        l_bRes = l_bRes && ( 15u == l_uRemL ) && ( 0u == eCU_DUNPKREC_GetRemL(&l_tURec) );
+        l_bRes = l_bRes && ( 0x12u == l_uVar8 ) && ( 0x3456u == l_uVar16 ) && ( 0x789ABCDEu == l_uVar32 ) &&
+                 ( 0x0123456789ABCDEFuLL == l_uVar64 );
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_NODATA == eCU_DUNPK_GetRec(&l_tCtxUnPack, 2u, &l_tURec) );
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopU8(&l_tCtxUnPack, &l_uVar8) );
+
+        if( true == l_bIsLE )
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DPKDUNPKTST_Record 4  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DPKDUNPKTST_Record 4  -- FAIL \n");
+            }
+
+            l_bIsLE = false;
+        }
+        else
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DPKDUNPKTST_Record 5  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DPKDUNPKTST_Record 5  -- FAIL \n");
+            }
+
+            l_bRes = false;
+        }
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), true);
+    l_tCtxPack.uMemPKCtr = sizeof(l_auMemPack) + 1u;
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 4u);
+    l_tCtxUnPack.uMemUPKCtr = 5u;
+    if( ( e_eCU_DPK_RES_CORRUPTCTX == eCU_DPK_ReserveRec(&l_tCtxPack, 1u, &l_tRec) ) &&
+        ( e_eCU_DUNPK_RES_CORRUPTCTX == eCU_DUNPK_GetRec(&l_tCtxUnPack, 1u, &l_tURec) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_Record 6  -- FAIL \n");
+    }
+}
+
+static void eCU_DPKDUNPKTST_ArrayElem(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    uint8_t l_auMemPack[28u];
+    uint8_t l_auMemExpected[28u];
+    uint16_t l_auData16[2u] = { 0x1234u, 0xABCDu };
+    uint32_t l_auData32[2u] = { 0x12345678u, 0x9ABCDEF0u };
+    uint64_t l_auData64[2u] = { 0x0123456789ABCDEFuLL, 0xFEDCBA9876543210uLL };
+    uint16_t l_auPop16[2u];
+    uint32_t l_auPop32[2u];
+    uint64_t l_auPop64[2u];
+    uint8_t* l_puPacked;
+    uint32_t l_uPackedL;
+    uint32_t l_uIdx;
+    bool_t l_bIsLE;
+    bool_t l_bRes;
+
+    /* Init variable */
+    l_tCtxPack.bIsInit = false;
+    l_tCtxUnPack.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_PushArrayU16(NULL, l_auData16, 2u) ) &&
+        ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_PushArrayU32(&l_tCtxPack, NULL, 2u) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_PopArrayU16(NULL, l_auPop16, 2u) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_PopArrayU64(&l_tCtxUnPack, NULL, 2u) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 1  -- FAIL \n");
+    }
+    if( ( e_eCU_DPK_RES_NOINITLIB == eCU_DPK_PushArrayU64(&l_tCtxPack, l_auData64, 2u) ) &&
+        ( e_eCU_DUNPK_RES_NOINITLIB == eCU_DUNPK_PopArrayU32(&l_tCtxUnPack, l_auPop32, 2u) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), true);
+    if( ( e_eCU_DPK_RES_BADPARAM == eCU_DPK_PushArrayU16(&l_tCtxPack, l_auData16, 0u) ) &&
+        ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushArrayU64(&l_tCtxPack, l_auData64, 4u) ) &&
+        ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushArrayU32(&l_tCtxPack, l_auData32, 0x40000001u) ) &&
+        ( e_eCU_DUNPK_RES_NOINITFRAME == eCU_DUNPK_PopArrayU16(&l_tCtxUnPack, l_auPop16, 2u) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_ArrayElem 3  -- FAIL \n");
+    }
+
+    /* Function, an array push must give the same data of the single push, in both endianness */
+    l_bIsLE = true;
+    l_bRes = true;
+    while( true == l_bRes )
+    {
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemExpected, sizeof(l_auMemExpected), l_bIsLE);
+        for( l_uIdx = 0u; l_uIdx < 2u; l_uIdx++ )
+        {
+            (void)eCU_DPK_PushU16(&l_tCtxPack, l_auData16[l_uIdx]);
+        }
+        for( l_uIdx = 0u; l_uIdx < 2u; l_uIdx++ )
+        {
+            (void)eCU_DPK_PushU32(&l_tCtxPack, l_auData32[l_uIdx]);
+        }
+        for( l_uIdx = 0u; l_uIdx < 2u; l_uIdx++ )
+        {
+            (void)eCU_DPK_PushU64(&l_tCtxPack, l_auData64[l_uIdx]);
+        }
+
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), l_bIsLE);
+        l_bRes = ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayU16(&l_tCtxPack, l_auData16, 2u) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayU32(&l_tCtxPack, l_auData32, 2u) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayU64(&l_tCtxPack, l_auData64, 2u) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) );
+        l_bRes = l_bRes && ( 28u == l_uPackedL ) && ( 0 == memcmp(l_puPacked, l_auMemExpected, l_uPackedL) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushArrayU16(&l_tCtxPack, l_auData16, 1u) );
+
+        /* Read back the arrays */
+        (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), l_bIsLE);
+        (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 28u);
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayU16(&l_tCtxUnPack, l_auPop16, 2u) );
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayU32(&l_tCtxUnPack, l_auPop32, 2u) );
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_NODATA == eCU_DUNPK_PopArrayU64(&l_tCtxUnPack, l_auPop64, 3u) );
+        l_bRes = l_bRes && ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayU64(&l_tCtxUnPack, l_auPop64, 2u) );
+        l_bRes = l_bRes && ( 0 == memcmp(l_auPop16, l_auData16, sizeof(l_auData16)) );
+        l_bRes = l_bRes && ( 0 == memcmp(l_auPop32, l_auData32, sizeof(l_auData32)) );
+        l_bRes = l_bRes && ( 0 == memcmp(l_auPop64, l_auData64, sizeof(l_auData64)) );
+
+        if( true == l_bIsLE )
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DPKDUNPKTST_ArrayElem 4  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DPKDUNPKTST_ArrayElem 4  -- FAIL \n");
+            }
+
+            l_bIsLE = false;
+        }
+        else
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DPKDUNPKTST_ArrayElem 5  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DPKDUNPKTST_ArrayElem 5  -- FAIL \n");
+            }
+
+            l_bRes = false;
+        }
+    }
+}
+
+static void eCU_DPKDUNPKTST_VarInt(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    uint8_t l_auMemPack[40u];
+    uint8_t l_auMemExpected[40u];
+    uint32_t l_auData32[4u] = { 0u, 127u, 300u, 0xFFFFFFFFu };
+    int32_t l_aiData32[4u] = { 0, -1, 1, -2147483647 - 1 };
+    uint64_t l_auData64[2u] = { 128u, 0xFFFFFFFFFFFFFFFFuLL };
+    int64_t l_aiData64[2u] = { -64, 9223372036854775807LL };
+    uint32_t l_auPop32[4u];
+    int32_t l_aiPop32[4u];
+    uint64_t l_auPop64[2u];
+    int64_t l_aiPop64[2u];
+    uint32_t l_uPop32;
+    int32_t l_iPop32;
+    uint64_t l_uPop64;
+    int64_t l_iPop64;
+    uint8_t* l_puPacked;
+    uint32_t l_uPackedL;
+    uint32_t l_uRemL;
+
+    /* Init variable */
+    l_tCtxPack.bIsInit = false;
+    l_tCtxUnPack.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_PushVarU32(NULL, 0u) ) &&
+        ( e_eCU_DPK_RES_BADPOINTER == eCU_DPK_PushArrayVarS64(&l_tCtxPack, NULL, 2u) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_PopVarU64(&l_tCtxUnPack, NULL) ) &&
+        ( e_eCU_DUNPK_RES_BADPOINTER == eCU_DUNPK_PopArrayVarS32(NULL, l_aiPop32, 4u) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 1  -- FAIL \n");
+    }
+    if( ( e_eCU_DPK_RES_NOINITLIB == eCU_DPK_PushVarS32(&l_tCtxPack, -1) ) &&
+        ( e_eCU_DUNPK_RES_NOINITLIB == eCU_DUNPK_PopVarU32(&l_tCtxUnPack, &l_uPop32) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), true);
+    if( ( e_eCU_DPK_RES_BADPARAM == eCU_DPK_PushArrayVarU32(&l_tCtxPack, l_auData32, 0u) ) &&
+        ( e_eCU_DUNPK_RES_NOINITFRAME == eCU_DUNPK_PopVarS64(&l_tCtxUnPack, &l_iPop64) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 3  -- FAIL \n");
+    }
+
+    /* Function, known encoding, the endianness of the packer does not change a varint */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), false);
+    l_auMemExpected[0u] = 0x00u;
+    l_auMemExpected[1u] = 0x7Fu;
+    l_auMemExpected[2u] = 0xACu;
+    l_auMemExpected[3u] = 0x02u;
+    l_auMemExpected[4u] = 0xFFu;
+    l_auMemExpected[5u] = 0xFFu;
+    l_auMemExpected[6u] = 0xFFu;
+    l_auMemExpected[7u] = 0xFFu;
+    l_auMemExpected[8u] = 0x0Fu;
+    l_auMemExpected[9u] = 0x00u;
+    l_auMemExpected[10u] = 0x01u;
+    l_auMemExpected[11u] = 0x02u;
+    l_auMemExpected[12u] = 0xFFu;
+    l_auMemExpected[13u] = 0xFFu;
+    l_auMemExpected[14u] = 0xFFu;
+    l_auMemExpected[15u] = 0xFFu;
+    l_auMemExpected[16u] = 0x0Fu;
+    l_auMemExpected[17u] = 0x80u;
+    l_auMemExpected[18u] = 0x01u;
+    (void)memset(&l_auMemExpected[19u], 0xFF, 9u);
+    l_auMemExpected[28u] = 0x01u;
+    l_auMemExpected[29u] = 0x7Fu;
+    if( ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayVarU32(&l_tCtxPack, l_auData32, 4u) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayVarS32(&l_tCtxPack, l_aiData32, 4u) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayVarU64(&l_tCtxPack, l_auData64, 2u) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_PushVarS64(&l_tCtxPack, l_aiData64[0u]) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) ) &&
+        ( 30u == l_uPackedL ) && ( 0 == memcmp(l_puPacked, l_auMemExpected, 30u) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 4  -- FAIL \n");
+    }
+
+    /* Function, round trip with the unpacker */
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, l_uPackedL);
+    if( ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayVarU32(&l_tCtxUnPack, l_auPop32, 4u) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayVarS32(&l_tCtxUnPack, l_aiPop32, 4u) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayVarU64(&l_tCtxUnPack, l_auPop64, 2u) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopVarS64(&l_tCtxUnPack, &l_iPop64) ) &&
+        ( 0 == memcmp(l_auPop32, l_auData32, sizeof(l_auData32)) ) &&
+        ( 0 == memcmp(l_aiPop32, l_aiData32, sizeof(l_aiData32)) ) &&
+        ( 0 == memcmp(l_auPop64, l_auData64, sizeof(l_auData64)) ) && ( l_aiData64[0u] == l_iPop64 ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_GetRemToPop(&l_tCtxUnPack, &l_uRemL) ) && ( 0u == l_uRemL ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 5  -- FAIL \n");
+    }
+
+    /* Function, scalar round trip */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, sizeof(l_auMemPack), true);
+    (void)eCU_DPK_PushVarU32(&l_tCtxPack, 0x12345678u);
+    (void)eCU_DPK_PushVarS32(&l_tCtxPack, -300);
+    (void)eCU_DPK_PushVarU64(&l_tCtxPack, 0x8000000000000000uLL);
+    (void)eCU_DPK_PushArrayVarS64(&l_tCtxPack, l_aiData64, 2u);
+    (void)eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL);
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, l_uPackedL);
+    if( ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopVarU32(&l_tCtxUnPack, &l_uPop32) ) && ( 0x12345678u == l_uPop32 ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopVarS32(&l_tCtxUnPack, &l_iPop32) ) && ( -300 == l_iPop32 ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopVarU64(&l_tCtxUnPack, &l_uPop64) ) &&
+        ( 0x8000000000000000uLL == l_uPop64 ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopArrayVarS64(&l_tCtxUnPack, l_aiPop64, 2u) ) &&
+        ( l_aiData64[0u] == l_aiPop64[0u] ) && ( l_aiData64[1u] == l_aiPop64[1u] ) &&
+        ( e_eCU_DUNPK_RES_NODATA == eCU_DUNPK_PopVarU32(&l_tCtxUnPack, &l_uPop32) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 6  -- FAIL \n");
+    }
+
+    /* Function, a truncated varint is no data, nothing is popped */
+    l_auMemPack[0u] = 0x05u;
+    l_auMemPack[1u] = 0x80u;
+    l_auMemPack[2u] = 0x80u;
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 3u);
+    if( ( e_eCU_DUNPK_RES_NODATA == eCU_DUNPK_PopArrayVarU32(&l_tCtxUnPack, l_auPop32, 2u) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_GetRemToPop(&l_tCtxUnPack, &l_uRemL) ) && ( 3u == l_uRemL ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 7  -- FAIL \n");
+    }
+
+    /* Function, varint too long or too big for the type */
+    (void)memset(l_auMemPack, 0x80, 11u);
+    l_auMemPack[11u] = 0x00u;
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 12u);
+    if( ( e_eCU_DUNPK_RES_BADDATA == eCU_DUNPK_PopVarU32(&l_tCtxUnPack, &l_uPop32) ) &&
+        ( e_eCU_DUNPK_RES_BADDATA == eCU_DUNPK_PopVarS64(&l_tCtxUnPack, &l_iPop64) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_GetRemToPop(&l_tCtxUnPack, &l_uRemL) ) && ( 12u == l_uRemL ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 8  -- FAIL \n");
+    }
+
+    /* Function */
+    l_auMemPack[0u] = 0xFFu;
+    l_auMemPack[1u] = 0xFFu;
+    l_auMemPack[2u] = 0xFFu;
+    l_auMemPack[3u] = 0xFFu;
+    l_auMemPack[4u] = 0x10u;
+    (void)memset(&l_auMemPack[5u], 0xFF, 9u);
+    l_auMemPack[14u] = 0x02u;
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 15u);
+    if( ( e_eCU_DUNPK_RES_BADDATA == eCU_DUNPK_PopVarU32(&l_tCtxUnPack, &l_uPop32) ) &&
+        ( e_eCU_DUNPK_RES_OK == eCU_DUNPK_PopVarU64(&l_tCtxUnPack, &l_uPop64) ) &&
+        ( 0x000000010FFFFFFFuLL == l_uPop64 ) &&
+        ( e_eCU_DUNPK_RES_BADDATA == eCU_DUNPK_PopVarU64(&l_tCtxUnPack, &l_uPop64) ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 9  -- FAIL \n");
+    }
+
+    /* Function, when the array does not fit nothing is pushed */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemPack, 8u, true);
+    (void)eCU_DPK_PushVarU32(&l_tCtxPack, 1u);
+    if( ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushArrayVarU32(&l_tCtxPack, l_auData32, 4u) ) &&
+        ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushVarU64(&l_tCtxPack, 0xFFFFFFFFFFFFFFFFuLL) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) ) &&
+        ( 1u == l_uPackedL ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_PushArrayVarU32(&l_tCtxPack, l_auData32, 3u) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_PushVarS32(&l_tCtxPack, -2) ) &&
+        ( e_eCU_DPK_RES_OUTOFMEM == eCU_DPK_PushVarU32(&l_tCtxPack, 0xFFFFFFFFu) ) &&
+        ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) ) &&
+        ( 6u == l_uPackedL ) )
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DPKDUNPKTST_VarInt 10 -- FAIL \n");
+    }
 }
\ No newline at end of file
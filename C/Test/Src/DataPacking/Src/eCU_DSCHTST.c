@@ -0,0 +1,391 @@
+/**
+ * @file       eCU_DSCHTST.c
+ *
+ * @brief      Data schema test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_DSCHTST.h"
+#include "eCU_DSCH.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TYPEDEFS
+ **********************************************************************************************************************/
+typedef struct
+{
+    uint8_t  uId;
+    uint16_t uFlags;
+    uint32_t auSample[3u];
+    uint64_t uTime;
+    uint8_t  auName[4u];
+    uint8_t  uVer;
+}t_eCU_DSCHTST_Msg;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE VARIABLE
+ **********************************************************************************************************************/
+static const t_eCU_DSCH_Field m_atMsgField[] =
+{
+    ECU_DSCH_FIELD( t_eCU_DSCHTST_Msg, uId ),
+    ECU_DSCH_FIELD( t_eCU_DSCHTST_Msg, uFlags ),
+    ECU_DSCH_ARRAY( t_eCU_DSCHTST_Msg, auSample ),
+    ECU_DSCH_FIELD( t_eCU_DSCHTST_Msg, uTime ),
+    ECU_DSCH_ARRAY( t_eCU_DSCHTST_Msg, auName ),
+    ECU_DSCH_FIELD( t_eCU_DSCHTST_Msg, uVer ),
+};
+
+static const t_eCU_DSCH_Schema m_tMsgSch = ECU_DSCH_SCHEMA( t_eCU_DSCHTST_Msg, m_atMsgField );
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_DSCHTST_BadPointer(void);
+static void eCU_DSCHTST_BadParamEntr(void);
+static void eCU_DSCHTST_BadInit(void);
+static void eCU_DSCHTST_KnownVector(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_DSCHTST_ExeTest(void)
+{
+	(void)printf("\n\nDATA SCHEMA TEST START \n\n");
+
+    eCU_DSCHTST_BadPointer();
+    eCU_DSCHTST_BadParamEntr();
+    eCU_DSCHTST_BadInit();
+    eCU_DSCHTST_KnownVector();
+
+    (void)printf("\n\nDATA SCHEMA TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_DSCHTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    t_eCU_DSCHTST_Msg l_tMsg;
+    t_eCU_DSCH_Schema l_tSch;
+    uint32_t l_uPackL;
+
+    /* Init variable */
+    l_tSch = m_tMsgSch;
+    l_tSch.ptField = NULL;
+    l_tCtxPack.bIsInit = false;
+    l_tCtxUnPack.bIsInit = false;
+    (void)memset(&l_tMsg, 0, sizeof(l_tMsg));
+
+    /* Function */
+    if( ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_GetPackL(NULL, &l_uPackL) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_GetPackL(&m_tMsgSch, NULL) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 1  -- FAIL \n");
+    }
+    if( ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Pack(NULL, &m_tMsgSch, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Pack(&l_tCtxPack, NULL, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Pack(&l_tCtxPack, &m_tMsgSch, NULL) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Pack(&l_tCtxPack, &l_tSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 2  -- FAIL \n");
+    }
+    if( ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Unpack(NULL, &m_tMsgSch, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Unpack(&l_tCtxUnPack, NULL, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, NULL) ) &&
+        ( e_eCU_DSCH_RES_BADPOINTER == eCU_DSCH_Unpack(&l_tCtxUnPack, &l_tSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadPointer 3  -- FAIL \n");
+    }
+}
+
+static void eCU_DSCHTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_DSCH_Field l_atField[2u];
+    t_eCU_DSCH_Schema l_tSch;
+    uint32_t l_uPackL;
+
+    /* Init variable */
+    l_atField[0u].uOff = 0u;
+    l_atField[0u].uElemL = 2u;
+    l_atField[0u].uCount = 2u;
+    l_atField[1u].uOff = 4u;
+    l_atField[1u].uElemL = 4u;
+    l_atField[1u].uCount = 1u;
+    l_tSch.ptField = l_atField;
+    l_tSch.uFieldN = 2u;
+    l_tSch.uStructL = 8u;
+
+    /* Function */
+    if( ( e_eCU_DSCH_RES_OK == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) ) && ( 8u == l_uPackL ) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tSch.uFieldN = 0u;
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tSch.uFieldN = 2u;
+    l_tSch.uStructL = 7u;
+    /* The last field is outside the struct */
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tSch.uStructL = 8u;
+    l_atField[1u].uElemL = 3u;
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* Function */
+    l_atField[1u].uElemL = 4u;
+    l_atField[1u].uCount = 0u;
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    /* Function */
+    l_atField[1u].uCount = 0x40000001u;
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    /* Function */
+    l_atField[1u].uCount = 1u;
+    l_atField[1u].uOff = 0xFFFFFFFFu;
+    if( e_eCU_DSCH_RES_BADPARAM == eCU_DSCH_GetPackL(&l_tSch, &l_uPackL) )
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadParamEntr 7  -- FAIL \n");
+    }
+}
+
+static void eCU_DSCHTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    t_eCU_DSCHTST_Msg l_tMsg;
+    uint8_t l_auMem[40u];
+    uint32_t l_uPackL;
+
+    /* Init variable */
+    l_tCtxPack.bIsInit = false;
+    l_tCtxUnPack.bIsInit = false;
+    (void)memset(&l_tMsg, 0, sizeof(l_tMsg));
+
+    /* Function */
+    if( ( e_eCU_DSCH_RES_NOINITLIB == eCU_DSCH_Pack(&l_tCtxPack, &m_tMsgSch, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_NOINITLIB == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadInit 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMem, sizeof(l_auMem), true);
+    (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMem, sizeof(l_auMem), true);
+    if( ( e_eCU_DSCH_RES_OK == eCU_DSCH_GetPackL(&m_tMsgSch, &l_uPackL) ) && ( 28u == l_uPackL ) &&
+        ( e_eCU_DSCH_RES_NOINITFRAME == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadInit 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMem, 27u, true);
+    (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, 27u);
+    /* Nothing is moved when the struct doesn't fit */
+    if( ( e_eCU_DSCH_RES_OUTOFMEM == eCU_DSCH_Pack(&l_tCtxPack, &m_tMsgSch, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_NODATA == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadInit 3  -- FAIL \n");
+    }
+    if( ( 0u == l_tCtxPack.uMemPKCtr ) && ( 0u == l_tCtxUnPack.uMemUPKCtr ) )
+    {
+        (void)printf("eCU_DSCHTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadInit 4  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tCtxPack.uMemPKCtr = 32u;
+    l_tCtxUnPack.uMemUPKCtr = 32u;
+    if( ( e_eCU_DSCH_RES_CORRUPTCTX == eCU_DSCH_Pack(&l_tCtxPack, &m_tMsgSch, &l_tMsg) ) &&
+        ( e_eCU_DSCH_RES_CORRUPTCTX == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsg) ) )
+    {
+        (void)printf("eCU_DSCHTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_DSCHTST_BadInit 5  -- FAIL \n");
+    }
+}
+
+static void eCU_DSCHTST_KnownVector(void)
+{
+    /* Local variable */
+    t_eCU_DPK_Ctx l_tCtxPack;
+    t_eCU_DUNPK_Ctx l_tCtxUnPack;
+    t_eCU_DSCHTST_Msg l_tMsg;
+    t_eCU_DSCHTST_Msg l_tMsgPop;
+    uint8_t l_auMem[40u];
+    uint8_t l_auMemExpected[40u];
+    uint8_t* l_puPacked;
+    uint32_t l_uPackedL;
+    uint32_t l_uIdx;
+    bool_t l_bIsLE;
+    bool_t l_bRes;
+
+    /* Init variable */
+    (void)memset(&l_tMsg, 0, sizeof(l_tMsg));
+    l_tMsg.uId = 0x11u;
+    l_tMsg.uFlags = 0x2233u;
+    l_tMsg.auSample[0u] = 0x44556677u;
+    l_tMsg.auSample[1u] = 0x8899AABBu;
+    l_tMsg.auSample[2u] = 0xCCDDEEFFu;
+    l_tMsg.uTime = 0x0123456789ABCDEFuLL;
+    l_tMsg.auName[0u] = 0x61u;
+    l_tMsg.auName[1u] = 0x62u;
+    l_tMsg.auName[2u] = 0x63u;
+    l_tMsg.auName[3u] = 0x64u;
+    l_tMsg.uVer = 0x05u;
+
+    /* Function, the struct must be packed like with the single push, in both endianness */
+    l_bIsLE = true;
+    l_bRes = true;
+    while( true == l_bRes )
+    {
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMemExpected, sizeof(l_auMemExpected), l_bIsLE);
+        (void)eCU_DPK_PushU8(&l_tCtxPack, l_tMsg.uId);
+        (void)eCU_DPK_PushU16(&l_tCtxPack, l_tMsg.uFlags);
+        for( l_uIdx = 0u; l_uIdx < 3u; l_uIdx++ )
+        {
+            (void)eCU_DPK_PushU32(&l_tCtxPack, l_tMsg.auSample[l_uIdx]);
+        }
+        (void)eCU_DPK_PushU64(&l_tCtxPack, l_tMsg.uTime);
+        (void)eCU_DPK_PushArray(&l_tCtxPack, l_tMsg.auName, 4u);
+        (void)eCU_DPK_PushU8(&l_tCtxPack, l_tMsg.uVer);
+
+        (void)eCU_DPK_InitCtx(&l_tCtxPack, l_auMem, sizeof(l_auMem), l_bIsLE);
+        l_bRes = ( e_eCU_DSCH_RES_OK == eCU_DSCH_Pack(&l_tCtxPack, &m_tMsgSch, &l_tMsg) );
+        l_bRes = l_bRes && ( e_eCU_DPK_RES_OK == eCU_DPK_GetDataReference(&l_tCtxPack, &l_puPacked, &l_uPackedL) );
+        l_bRes = l_bRes && ( 28u == l_uPackedL ) && ( 0 == memcmp(l_puPacked, l_auMemExpected, l_uPackedL) );
+
+        /* Read back the struct, padding is not touched */
+        (void)memset(&l_tMsgPop, 0, sizeof(l_tMsgPop));
+        (void)eCU_DUNPK_InitCtx(&l_tCtxUnPack, l_auMem, sizeof(l_auMem), l_bIsLE);
+        (void)eCU_DUNPK_StartNewFrame(&l_tCtxUnPack, l_uPackedL);
+        l_bRes = l_bRes && ( e_eCU_DSCH_RES_OK == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsgPop) );
+        l_bRes = l_bRes && ( 0 == memcmp(&l_tMsgPop, &l_tMsg, sizeof(l_tMsg)) );
+        l_bRes = l_bRes && ( e_eCU_DSCH_RES_NODATA == eCU_DSCH_Unpack(&l_tCtxUnPack, &m_tMsgSch, &l_tMsgPop) );
+
+        if( true == l_bIsLE )
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DSCHTST_KnownVector 1  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DSCHTST_KnownVector 1  -- FAIL \n");
+            }
+
+            l_bIsLE = false;
+        }
+        else
+        {
+            if( true == l_bRes )
+            {
+                (void)printf("eCU_DSCHTST_KnownVector 2  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eCU_DSCHTST_KnownVector 2  -- FAIL \n");
+            }
+
+            l_bRes = false;
+        }
+    }
+}
\ No newline at end of file
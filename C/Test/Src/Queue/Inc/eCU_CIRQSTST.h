@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_CIRQSTST.h
+ *
+ * @brief      Circular queue set test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_CIRQSTST_H
+#define ECU_CIRQSTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the circular queue set module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_CIRQSTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_CIRQSTST_H */
\ No newline at end of file
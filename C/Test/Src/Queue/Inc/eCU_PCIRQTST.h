@@ -0,0 +1,48 @@
+/**
+ * @file       eCU_PCIRQTST.h
+ *
+ * @brief      Persistent circular queue test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef ECU_PCIRQTST_H
+#define ECU_PCIRQTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the persistent circular queue module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eCU_PCIRQTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* ECU_PCIRQTST_H */
\ No newline at end of file
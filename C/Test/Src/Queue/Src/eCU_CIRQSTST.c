@@ -0,0 +1,746 @@
+/**
+ * @file       eCU_CIRQSTST.c
+ *
+ * @brief      Circular queue set test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_CIRQSTST.h"
+#include "eCU_CIRQS.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_CIRQSTST_BadPointer(void);
+static void eCU_CIRQSTST_BadInit(void);
+static void eCU_CIRQSTST_BadParamEntr(void);
+static void eCU_CIRQSTST_CorruptedContext(void);
+static void eCU_CIRQSTST_Drain(void);
+static void eCU_CIRQSTST_RoundRobin(void);
+static void eCU_CIRQSTST_ManyQueue(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_CIRQSTST_ExeTest(void)
+{
+	(void)printf("\n\nCIRCULAR QUEUE SET TEST START \n\n");
+
+    eCU_CIRQSTST_BadPointer();
+    eCU_CIRQSTST_BadInit();
+    eCU_CIRQSTST_BadParamEntr();
+    eCU_CIRQSTST_CorruptedContext();
+    eCU_CIRQSTST_Drain();
+    eCU_CIRQSTST_RoundRobin();
+    eCU_CIRQSTST_ManyQueue();
+
+    (void)printf("\n\nCIRCULAR QUEUE SET TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_CIRQSTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[2u];
+    t_eCU_CIRQS_Drain l_atDrain[2u];
+    uint32_t l_auReadyMap[1u];
+    uint8_t  l_auData[5u] = {0u};
+    uint32_t l_uDrainN;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_InitCtx(NULL, l_atQueue, 2u, l_auReadyMap, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_InitCtx(&l_tCtx, NULL, 2u, l_auReadyMap, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, NULL, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_InsertData(&l_tCtx, 0u, NULL, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_DrainReady(&l_tCtx, NULL, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                           &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, NULL, 2u,
+                                                           &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPOINTER == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                           NULL) )
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadPointer 9  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[2u];
+    t_eCU_CIRQS_Drain l_atDrain[2u];
+    uint32_t l_auReadyMap[1u];
+    uint8_t  l_auMem[2u][5u];
+    uint8_t  l_auData[5u] = {0u};
+    uint32_t l_uDrainN;
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_CIRQS_RES_NOINITLIB == eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_NOINITLIB == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                          &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eCU_CIRQSTST_BadInit 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_BadInit 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 3  -- FAIL \n");
+    }
+
+    /* A queue of the set is not initialized */
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[0u], l_auMem[0u], sizeof(l_auMem[0u]));
+    l_atQueue[1u].bIsInit = false;
+    if( e_eCU_CIRQS_RES_NOINITLIB == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 4  -- FAIL \n");
+    }
+
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[1u], l_auMem[1u], sizeof(l_auMem[1u]));
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eCU_CIRQSTST_BadInit 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_BadInit 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadInit 6  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[40u];
+    t_eCU_CIRQS_Drain l_atDrain[2u];
+    uint32_t l_auReadyMap[2u];
+    uint8_t  l_auMem[40u][5u];
+    uint8_t  l_auData[5u] = {0u};
+    uint32_t l_uDrainN;
+    uint32_t l_uIdx;
+
+    /* Init variable */
+    for( l_uIdx = 0u; l_uIdx < 40u; l_uIdx++ )
+    {
+        (void)eCU_CIRQ_InitCtx(&l_atQueue[l_uIdx], l_auMem[l_uIdx], sizeof(l_auMem[l_uIdx]));
+    }
+
+    /* Function */
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 0u, l_auReadyMap, 2u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* 40 queue need two word of bitmap */
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 40u, l_auReadyMap, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 40u, l_auReadyMap, 2u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_InsertData(&l_tCtx, 40u, l_auData, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 0u) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, 0u, 1u, l_atDrain, 2u, &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 0u, l_atDrain, 2u,
+                                                         &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_BADPARAM == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 0u,
+                                                         &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_EMPTY == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                      &l_uDrainN) )
+    {
+        if( 0u == l_uDrainN )
+        {
+            (void)printf("eCU_CIRQSTST_BadParamEntr 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_BadParamEntr 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_BadParamEntr 9  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[2u];
+    t_eCU_CIRQS_Drain l_atDrain[2u];
+    uint32_t l_auReadyMap[1u];
+    uint8_t  l_auMem[2u][5u];
+    uint8_t  l_auData[5u] = {0u};
+    uint32_t l_uDrainN;
+
+    /* Init variable */
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[0u], l_auMem[0u], sizeof(l_auMem[0u]));
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[1u], l_auMem[1u], sizeof(l_auMem[1u]));
+
+    /* Function */
+    (void)eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u);
+    l_tCtx.ptQueue = NULL;
+    if( e_eCU_CIRQS_RES_CORRUPTCTX == eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 1u) )
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u);
+    l_tCtx.uNextQueue = 2u;
+    if( e_eCU_CIRQS_RES_CORRUPTCTX == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                           &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* Bit of a queue not present in the set */
+    (void)eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u);
+    l_auReadyMap[0u] = 0x04u;
+    if( e_eCU_CIRQS_RES_CORRUPTCTX == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                           &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    /* One of the queue is corrupted */
+    (void)eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 2u, l_auReadyMap, 1u);
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 1u, l_auData, 1u);
+    l_atQueue[1u].uBuffL = 0u;
+    if( e_eCU_CIRQS_RES_CORRUPTCTX == eCU_CIRQS_DrainReady(&l_tCtx, l_auData, sizeof(l_auData), 1u, l_atDrain, 2u,
+                                                           &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_Drain(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[3u];
+    t_eCU_CIRQS_Drain l_atDrain[3u];
+    uint32_t l_auReadyMap[1u];
+    uint8_t  l_auMem[3u][6u];
+    uint8_t  l_auDest[10u];
+    uint8_t  l_auData[6u] = {0u, 1u, 2u, 3u, 4u, 5u};
+    uint32_t l_uDrainN;
+
+    /* Init variable */
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[0u], l_auMem[0u], sizeof(l_auMem[0u]));
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[1u], l_auMem[1u], sizeof(l_auMem[1u]));
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[2u], l_auMem[2u], sizeof(l_auMem[2u]));
+
+    /* Data inserted before the init of the set are detected */
+    (void)eCU_CIRQ_InsertData(&l_atQueue[2u], l_auData, 2u);
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 3u, l_auReadyMap, 1u) )
+    {
+        if( 0x04u == l_auReadyMap[0u] )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 6u) )
+    {
+        if( 0x05u == l_auReadyMap[0u] )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 2  -- FAIL \n");
+    }
+
+    /* Max 4 byte from every queue: queue 0 is partially drained and remain ready, queue 2 became empty */
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 4u, l_atDrain, 3u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 2u == l_uDrainN ) && ( 0x01u == l_auReadyMap[0u] ) &&
+            ( 0u == l_atDrain[0u].uQueueIdx ) && ( 0u == l_atDrain[0u].uDataOffset ) &&
+            ( 4u == l_atDrain[0u].uDataL ) && ( 2u == l_atDrain[1u].uQueueIdx ) &&
+            ( 4u == l_atDrain[1u].uDataOffset ) && ( 2u == l_atDrain[1u].uDataL ) &&
+            ( 0 == memcmp(l_auDest, l_auData, 4u) ) && ( 0 == memcmp(&l_auDest[4u], l_auData, 2u) ) )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 3  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 4u, l_atDrain, 3u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 1u == l_uDrainN ) && ( 0x00u == l_auReadyMap[0u] ) && ( 0u == l_atDrain[0u].uQueueIdx ) &&
+            ( 2u == l_atDrain[0u].uDataL ) && ( 0 == memcmp(l_auDest, &l_auData[4u], 2u) ) )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 4  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_EMPTY == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 4u, l_atDrain, 3u,
+                                                      &l_uDrainN) )
+    {
+        (void)printf("eCU_CIRQSTST_Drain 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 5  -- FAIL \n");
+    }
+
+    /* Destination smaller than the ready data */
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 1u, l_auData, 6u);
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 2u, l_auData, 6u);
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 6u, l_atDrain, 3u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 2u == l_uDrainN ) && ( 0x04u == l_auReadyMap[0u] ) && ( 1u == l_atDrain[0u].uQueueIdx ) &&
+            ( 6u == l_atDrain[0u].uDataL ) && ( 2u == l_atDrain[1u].uQueueIdx ) && ( 4u == l_atDrain[1u].uDataL ) )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 6  -- FAIL \n");
+    }
+
+    /* Drain table smaller than the ready queues */
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 1u);
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 6u, l_atDrain, 1u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 1u == l_uDrainN ) && ( 0x04u == l_auReadyMap[0u] ) && ( 0u == l_atDrain[0u].uQueueIdx ) &&
+            ( 1u == l_atDrain[0u].uDataL ) )
+        {
+            (void)printf("eCU_CIRQSTST_Drain 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_Drain 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_Drain 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_RoundRobin(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[3u];
+    t_eCU_CIRQS_Drain l_atDrain[3u];
+    uint32_t l_auReadyMap[1u];
+    uint8_t  l_auMem[3u][10u];
+    uint8_t  l_auDest[10u];
+    uint8_t  l_auData[10u] = {0u};
+    uint32_t l_uDrainN;
+
+    /* Init variable */
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[0u], l_auMem[0u], sizeof(l_auMem[0u]));
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[1u], l_auMem[1u], sizeof(l_auMem[1u]));
+    (void)eCU_CIRQ_InitCtx(&l_atQueue[2u], l_auMem[2u], sizeof(l_auMem[2u]));
+    (void)eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 3u, l_auReadyMap, 1u);
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 0u, l_auData, 10u);
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 1u, l_auData, 10u);
+    (void)eCU_CIRQS_InsertData(&l_tCtx, 2u, l_auData, 10u);
+
+    /* Only one queue every call, every queue must be served before serving the first one again */
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 1u, l_atDrain, 1u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 1u == l_uDrainN ) && ( 0u == l_atDrain[0u].uQueueIdx ) )
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_RoundRobin 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 1u, l_atDrain, 1u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 1u == l_uDrainN ) && ( 1u == l_atDrain[0u].uQueueIdx ) )
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_RoundRobin 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 1u, l_atDrain, 1u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 1u == l_uDrainN ) && ( 2u == l_atDrain[0u].uQueueIdx ) )
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_RoundRobin 3  -- FAIL \n");
+    }
+
+    /* Start from queue 0 again, but drain all the ready queues */
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 1u, l_atDrain, 3u,
+                                                   &l_uDrainN) )
+    {
+        if( ( 3u == l_uDrainN ) && ( 0u == l_atDrain[0u].uQueueIdx ) && ( 1u == l_atDrain[1u].uQueueIdx ) &&
+            ( 2u == l_atDrain[2u].uQueueIdx ) && ( 2u == l_atDrain[2u].uDataOffset ) )
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQSTST_RoundRobin 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_RoundRobin 4  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQSTST_ManyQueue(void)
+{
+    /* Local variable */
+    t_eCU_CIRQS_Ctx l_tCtx;
+    t_eCU_CIRQ_Ctx l_atQueue[64u];
+    t_eCU_CIRQS_Drain l_atDrain[64u];
+    uint32_t l_auReadyMap[ECU_CIRQS_READYMAPL(64u)];
+    uint8_t  l_auMem[64u][4u];
+    uint8_t  l_auDest[256u];
+    uint8_t  l_uData;
+    uint32_t l_uDrainN;
+    uint32_t l_uIdx;
+    uint32_t l_uCycle;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    for( l_uIdx = 0u; l_uIdx < 64u; l_uIdx++ )
+    {
+        (void)eCU_CIRQ_InitCtx(&l_atQueue[l_uIdx], l_auMem[l_uIdx], sizeof(l_auMem[l_uIdx]));
+    }
+
+    if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_InitCtx(&l_tCtx, l_atQueue, 64u, l_auReadyMap, ECU_CIRQS_READYMAPL(64u)) )
+    {
+        (void)printf("eCU_CIRQSTST_ManyQueue 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_ManyQueue 1  -- FAIL \n");
+    }
+
+    /* Only few queue active every cycle, in both the bitmap words */
+    l_bTestOk = true;
+    for( l_uCycle = 0u; ( l_uCycle < 100u ) && ( true == l_bTestOk ); l_uCycle++ )
+    {
+        l_uData = ( uint8_t ) l_uCycle;
+        (void)eCU_CIRQS_InsertData(&l_tCtx, ( l_uCycle % 64u ), &l_uData, 1u);
+        (void)eCU_CIRQS_InsertData(&l_tCtx, 31u, &l_uData, 1u);
+        (void)eCU_CIRQS_InsertData(&l_tCtx, 63u, &l_uData, 1u);
+
+        if( e_eCU_CIRQS_RES_OK == eCU_CIRQS_DrainReady(&l_tCtx, l_auDest, sizeof(l_auDest), 4u, l_atDrain, 64u,
+                                                       &l_uDrainN) )
+        {
+            if( ( ( 31u == ( l_uCycle % 64u ) ) || ( 63u == ( l_uCycle % 64u ) ) ) )
+            {
+                if( 2u != l_uDrainN )
+                {
+                    l_bTestOk = false;
+                }
+            }
+            else
+            {
+                if( 3u != l_uDrainN )
+                {
+                    l_bTestOk = false;
+                }
+            }
+
+            for( l_uIdx = 0u; l_uIdx < l_uDrainN; l_uIdx++ )
+            {
+                if( l_auDest[l_atDrain[l_uIdx].uDataOffset] != l_uData )
+                {
+                    l_bTestOk = false;
+                }
+            }
+
+            if( ( 0u != l_auReadyMap[0u] ) || ( 0u != l_auReadyMap[1u] ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_CIRQSTST_ManyQueue 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQSTST_ManyQueue 2  -- FAIL \n");
+    }
+}
\ No newline at end of file
@@ -33,6 +33,11 @@ static void eCU_CIRQTST_FullMem(void);
 static void eCU_CIRQTST_Generic(void);
 static void eCU_CIRQTST_Cycle1(void);
 static void eCU_CIRQTST_Cycle2(void);
+static void eCU_CIRQTST_FreeSeg(void);
+static void eCU_CIRQTST_OccupiedSeg(void);
+#ifdef ECU_CIRQ_ENABLESTATS
+static void eCU_CIRQTST_Stats(void);
+#endif
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
@@ -50,6 +55,11 @@ void eCU_CIRQTST_ExeTest(void)
     eCU_CIRQTST_Generic();
     eCU_CIRQTST_Cycle1();
     eCU_CIRQTST_Cycle2();
+    eCU_CIRQTST_FreeSeg();
+    eCU_CIRQTST_OccupiedSeg();
+#ifdef ECU_CIRQ_ENABLESTATS
+    eCU_CIRQTST_Stats();
+#endif
 
     (void)printf("\n\nCIRCULAR QUEUE TEST END \n\n");
 }
@@ -1231,6 +1241,324 @@ static void eCU_CIRQTST_Cycle2(void)
     }
 }
 
+static void eCU_CIRQTST_FreeSeg(void)
+{
+    /* Local variable */
+    t_eCU_CIRQ_Ctx l_tCtx;
+    uint8_t  l_auPointerMempool[10u];
+    uint8_t  l_auRetriveData[10u] = {0u};
+    uint8_t  l_auInsertData[5u]  = {0u, 1u, 2u, 3u, 4u};
+    uint8_t* l_puSeg;
+    uint32_t l_uSegL;
+    uint32_t l_uIdx;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetFreeSeg(NULL, &l_puSeg, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetFreeSeg(&l_tCtx, NULL, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, NULL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_CommitData(NULL, 1u) ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 1  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CIRQ_RES_NOINITLIB == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_NOINITLIB == eCU_CIRQ_CommitData(&l_tCtx, 1u) ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CIRQ_InitCtx(&l_tCtx, l_auPointerMempool, sizeof(l_auPointerMempool));
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[0u] == l_puSeg ) && ( 10u == l_uSegL ) &&
+        ( e_eCU_CIRQ_RES_BADPARAM == eCU_CIRQ_CommitData(&l_tCtx, 0u) ) &&
+        ( e_eCU_CIRQ_RES_FULL == eCU_CIRQ_CommitData(&l_tCtx, 11u) ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 3  -- FAIL \n");
+    }
+
+    /* Function, data written in the free area is retrived after the commit */
+    (void)memcpy(l_puSeg, l_auInsertData, 3u);
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_CommitData(&l_tCtx, 3u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 3u) ) &&
+        ( 0 == memcmp(l_auRetriveData, l_auInsertData, 3u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[3u] == l_puSeg ) && ( 7u == l_uSegL ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 4  -- FAIL \n");
+    }
+
+    /* Function, free space that wrap is returned in two area */
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 5u);
+    (void)eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 4u);
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[8u] == l_puSeg ) && ( 2u == l_uSegL ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 5  -- FAIL \n");
+    }
+
+    /* Function */
+    l_puSeg[0u] = 0x10u;
+    l_puSeg[1u] = 0x11u;
+    (void)eCU_CIRQ_CommitData(&l_tCtx, 2u);
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[0u] == l_puSeg ) && ( 7u == l_uSegL ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 6  -- FAIL \n");
+    }
+
+    /* Function, fill the queue */
+    for( l_uIdx = 0u; l_uIdx < 7u; l_uIdx++ )
+    {
+        l_puSeg[l_uIdx] = (uint8_t)( 0x20u + l_uIdx );
+    }
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_CommitData(&l_tCtx, 7u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetFreeSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) && ( 0u == l_uSegL ) &&
+        ( e_eCU_CIRQ_RES_FULL == eCU_CIRQ_CommitData(&l_tCtx, 1u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 10u) ) &&
+        ( 0x04u == l_auRetriveData[0u] ) && ( 0x10u == l_auRetriveData[1u] ) && ( 0x11u == l_auRetriveData[2u] ) &&
+        ( 0x20u == l_auRetriveData[3u] ) && ( 0x26u == l_auRetriveData[9u] ) )
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_FreeSeg 7  -- FAIL \n");
+    }
+}
+
+static void eCU_CIRQTST_OccupiedSeg(void)
+{
+    /* Local variable */
+    t_eCU_CIRQ_Ctx l_tCtx;
+    uint8_t  l_auPointerMempool[10u];
+    uint8_t  l_auRetriveData[10u] = {0u};
+    uint8_t  l_auInsertData[8u]  = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u};
+    const uint8_t* l_puSeg;
+    uint32_t l_uSegL;
+    uint32_t l_uUsedL;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetOccupiedSeg(NULL, &l_puSeg, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, NULL, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, &l_puSeg, NULL) ) &&
+        ( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_DiscardData(NULL, 1u) ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 1  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CIRQ_RES_NOINITLIB == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( e_eCU_CIRQ_RES_NOINITLIB == eCU_CIRQ_DiscardData(&l_tCtx, 1u) ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eCU_CIRQ_InitCtx(&l_tCtx, l_auPointerMempool, sizeof(l_auPointerMempool));
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) && ( 0u == l_uSegL ) &&
+        ( e_eCU_CIRQ_RES_BADPARAM == eCU_CIRQ_DiscardData(&l_tCtx, 0u) ) &&
+        ( e_eCU_CIRQ_RES_EMPTY == eCU_CIRQ_DiscardData(&l_tCtx, 1u) ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 3  -- FAIL \n");
+    }
+
+    /* Function, occupied space that wrap is returned in two area */
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 8u);
+    (void)eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 6u);
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 5u);
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[6u] == l_puSeg ) && ( 4u == l_uSegL ) &&
+        ( 6u == l_puSeg[0u] ) && ( 7u == l_puSeg[1u] ) && ( 0u == l_puSeg[2u] ) && ( 1u == l_puSeg[3u] ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 4  -- FAIL \n");
+    }
+
+    if( ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_DiscardData(&l_tCtx, 4u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSeg(&l_tCtx, &l_puSeg, &l_uSegL) ) &&
+        ( &l_auPointerMempool[0u] == l_puSeg ) && ( 3u == l_uSegL ) && ( 2u == l_puSeg[0u] ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetOccupiedSapce(&l_tCtx, &l_uUsedL) ) && ( 3u == l_uUsedL ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 5  -- FAIL \n");
+    }
+
+    /* Function, remaining data is still retrivable */
+    if( ( e_eCU_CIRQ_RES_EMPTY == eCU_CIRQ_DiscardData(&l_tCtx, 4u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_DiscardData(&l_tCtx, 1u) ) &&
+        ( e_eCU_CIRQ_RES_OK == eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 2u) ) &&
+        ( 3u == l_auRetriveData[0u] ) && ( 4u == l_auRetriveData[1u] ) )
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_OccupiedSeg 6  -- FAIL \n");
+    }
+}
+
 #ifdef __IAR_SYSTEMS_ICC__
     #pragma cstat_restore = "CERT-STR32-C"
+#endif
+
+#ifdef ECU_CIRQ_ENABLESTATS
+static void eCU_CIRQTST_Stats(void)
+{
+    /* Local variable */
+    t_eCU_CIRQ_Ctx l_tCtx;
+    t_eCU_CIRQ_Stats l_tStats;
+    uint8_t  l_auPointerMempool[10u];
+    uint8_t  l_auRetriveData[10u] = {0u};
+    uint8_t  l_auInsertData[7u]  = {0u, 1u, 2u, 3u, 4u, 5u, 6u};
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetStats(NULL, &l_tStats) )
+    {
+        (void)printf("eCU_CIRQTST_Stats 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 1  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQ_RES_BADPOINTER == eCU_CIRQ_GetStats(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_CIRQTST_Stats 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 2  -- FAIL \n");
+    }
+
+    if( e_eCU_CIRQ_RES_NOINITLIB == eCU_CIRQ_GetStats(&l_tCtx, &l_tStats) )
+    {
+        (void)printf("eCU_CIRQTST_Stats 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 3  -- FAIL \n");
+    }
+
+    (void)eCU_CIRQ_InitCtx(&l_tCtx, l_auPointerMempool, sizeof(l_auPointerMempool));
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 7u);
+    (void)eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 3u);
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 5u);
+    (void)eCU_CIRQ_InsertData(&l_tCtx, l_auInsertData, 2u);
+    (void)eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 10u);
+    (void)eCU_CIRQ_RetriveData(&l_tCtx, l_auRetriveData, 9u);
+    (void)eCU_CIRQ_PeekData(&l_tCtx, l_auRetriveData, 1u);
+
+    if( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetStats(&l_tCtx, &l_tStats) )
+    {
+        if( ( 12u == l_tStats.uInBytes ) && ( 2u == l_tStats.uInsertCall ) && ( 1u == l_tStats.uFullRej ) &&
+            ( 9u == l_tStats.uPeakUsedL ) && ( 1u == l_tStats.uInWrapCopy ) && ( 12u == l_tStats.uOutBytes ) &&
+            ( 2u == l_tStats.uRetriveCall ) && ( 2u == l_tStats.uEmptyRej ) && ( 1u == l_tStats.uOutWrapCopy ) )
+        {
+            (void)printf("eCU_CIRQTST_Stats 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQTST_Stats 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 4  -- FAIL \n");
+    }
+
+    (void)eCU_CIRQ_Reset(&l_tCtx);
+    if( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetStats(&l_tCtx, &l_tStats) )
+    {
+        if( ( 12u == l_tStats.uInBytes ) && ( 9u == l_tStats.uPeakUsedL ) )
+        {
+            (void)printf("eCU_CIRQTST_Stats 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQTST_Stats 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 5  -- FAIL \n");
+    }
+
+    (void)eCU_CIRQ_InitCtx(&l_tCtx, l_auPointerMempool, sizeof(l_auPointerMempool));
+    if( e_eCU_CIRQ_RES_OK == eCU_CIRQ_GetStats(&l_tCtx, &l_tStats) )
+    {
+        if( ( 0u == l_tStats.uInBytes ) && ( 0u == l_tStats.uPeakUsedL ) && ( 0u == l_tStats.uEmptyRej ) )
+        {
+            (void)printf("eCU_CIRQTST_Stats 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_CIRQTST_Stats 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 6  -- FAIL \n");
+    }
+
+    l_tCtx.uBuffL = 0u;
+    if( e_eCU_CIRQ_RES_CORRUPTCTX == eCU_CIRQ_GetStats(&l_tCtx, &l_tStats) )
+    {
+        (void)printf("eCU_CIRQTST_Stats 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_CIRQTST_Stats 7  -- FAIL \n");
+    }
+}
 #endif
\ No newline at end of file
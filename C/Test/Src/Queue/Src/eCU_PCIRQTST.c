@@ -0,0 +1,575 @@
+/**
+ * @file       eCU_PCIRQTST.c
+ *
+ * @brief      Persistent circular queue test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eCU_PCIRQTST.h"
+#include "eCU_PCIRQ.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eCU_PCIRQTST_BadPointer(void);
+static void eCU_PCIRQTST_BadInit(void);
+static void eCU_PCIRQTST_BadParamEntr(void);
+static void eCU_PCIRQTST_CorruptedContext(void);
+static void eCU_PCIRQTST_Recover(void);
+static void eCU_PCIRQTST_RecoverCorrupted(void);
+static void eCU_PCIRQTST_Cycle(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eCU_PCIRQTST_ExeTest(void)
+{
+	(void)printf("\n\nPERSISTENT CIRCULAR QUEUE TEST START \n\n");
+
+    eCU_PCIRQTST_BadPointer();
+    eCU_PCIRQTST_BadInit();
+    eCU_PCIRQTST_BadParamEntr();
+    eCU_PCIRQTST_CorruptedContext();
+    eCU_PCIRQTST_Recover();
+    eCU_PCIRQTST_RecoverCorrupted();
+    eCU_PCIRQTST_Cycle();
+
+    (void)printf("\n\nPERSISTENT CIRCULAR QUEUE TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eCU_PCIRQTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 5u];
+    uint32_t l_uVarTemp;
+
+    /* Function */
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_InitCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_InitCtx(&l_tCtx, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_RecoverCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_RecoverCtx(&l_tCtx, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_Reset(NULL) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_GetFreeSapce(NULL, &l_uVarTemp) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_GetOccupiedSapce(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_InsertData(&l_tCtx, NULL, 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_RetriveData(NULL, l_auMem, 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_PeekData(&l_tCtx, NULL, 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPOINTER == eCU_PCIRQ_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadPointer 11 -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_BadInit(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 5u];
+    uint8_t  l_auData[2u] = {0u};
+    uint32_t l_uVarTemp;
+    bool_t l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( e_eCU_PCIRQ_RES_NOINITLIB == eCU_PCIRQ_Reset(&l_tCtx) )
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_NOINITLIB == eCU_PCIRQ_GetFreeSapce(&l_tCtx, &l_uVarTemp) )
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_NOINITLIB == eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_NOINITLIB == eCU_PCIRQ_RetriveData(&l_tCtx, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eCU_PCIRQTST_BadInit 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_BadInit 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadInit 6  -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 5u];
+    uint8_t  l_auData[6u] = {0u};
+
+    /* Function */
+    if( e_eCU_PCIRQ_RES_BADPARAM == eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, ECU_PCIRQ_HEADERL) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPARAM == eCU_PCIRQ_RecoverCtx(&l_tCtx, l_auMem, ECU_PCIRQ_HEADERL) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_BADPARAM == eCU_PCIRQ_InsertData(&l_tCtx, l_auData, 0u) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_FULL == eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_EMPTY == eCU_PCIRQ_RetriveData(&l_tCtx, l_auData, 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_BadParamEntr 6  -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 5u];
+    uint8_t  l_auData[2u] = {0u};
+    uint32_t l_uVarTemp;
+
+    /* Function */
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+    l_tCtx.puMem = NULL;
+
+    if( e_eCU_PCIRQ_RES_CORRUPTCTX == eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+    l_tCtx.tCirq.puBuff = l_auMem;
+
+    if( e_eCU_PCIRQ_RES_CORRUPTCTX == eCU_PCIRQ_GetFreeSapce(&l_tCtx, &l_uVarTemp) )
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+    l_tCtx.tCirq.uBuffFreeIdx = 5u;
+
+    if( e_eCU_PCIRQ_RES_CORRUPTCTX == eCU_PCIRQ_RetriveData(&l_tCtx, l_auData, 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_CorruptedContext 3  -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_Recover(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    t_eCU_PCIRQ_Ctx l_tCtxRec;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 10u];
+    uint8_t  l_auData[6u] = {1u, 2u, 3u, 4u, 5u, 6u};
+    uint8_t  l_auDataRet[6u] = {0u};
+    uint32_t l_uVarTemp;
+
+    /* Memory never used */
+    (void)memset(l_auMem, 0, sizeof(l_auMem));
+
+    if( e_eCU_PCIRQ_RES_NOVALIDHEADER == eCU_PCIRQ_RecoverCtx(&l_tCtxRec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_Recover 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 1  -- FAIL \n");
+    }
+
+    /* Fill and move the queue over the wrap */
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+    (void)eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData));
+    (void)eCU_PCIRQ_RetriveData(&l_tCtx, l_auDataRet, 4u);
+    (void)eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData));
+
+    /* Simulate a restart of the application */
+    l_tCtxRec.bIsInit = false;
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RecoverCtx(&l_tCtxRec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_Recover 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 2  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_GetOccupiedSapce(&l_tCtxRec, &l_uVarTemp) )
+    {
+        if( 8u == l_uVarTemp )
+        {
+            (void)printf("eCU_PCIRQTST_Recover 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_Recover 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 3  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RetriveData(&l_tCtxRec, l_auDataRet, 2u) )
+    {
+        if( 0 == memcmp(&l_auData[4u], l_auDataRet, 2u) )
+        {
+            (void)printf("eCU_PCIRQTST_Recover 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_Recover 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 4  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RetriveData(&l_tCtxRec, l_auDataRet, 6u) )
+    {
+        if( 0 == memcmp(l_auData, l_auDataRet, 6u) )
+        {
+            (void)printf("eCU_PCIRQTST_Recover 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_Recover 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 5  -- FAIL \n");
+    }
+
+    /* Recovering with a different dimension must fail */
+    if( e_eCU_PCIRQ_RES_NOVALIDHEADER == eCU_PCIRQ_RecoverCtx(&l_tCtxRec, l_auMem, sizeof(l_auMem) - 1u) )
+    {
+        (void)printf("eCU_PCIRQTST_Recover 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Recover 6  -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_RecoverCorrupted(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    t_eCU_PCIRQ_Ctx l_tCtxRec;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 10u];
+    uint8_t  l_auData[3u] = {1u, 2u, 3u};
+    uint32_t l_uVarTemp;
+    uint32_t l_uLastSlot;
+
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+    (void)eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData));
+    (void)eCU_PCIRQ_InsertData(&l_tCtx, l_auData, sizeof(l_auData));
+
+    /* Simulate an interrupted write of the last header copy, the previous status must be recovered */
+    l_uLastSlot = ( l_tCtx.uSeq & 1u ) * ( ECU_PCIRQ_HEADERL / 2u );
+    l_auMem[l_uLastSlot + 4u] ^= 0xFFu;
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RecoverCtx(&l_tCtxRec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 1  -- FAIL \n");
+    }
+
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_GetOccupiedSapce(&l_tCtxRec, &l_uVarTemp) )
+    {
+        if( 3u == l_uVarTemp )
+        {
+            (void)printf("eCU_PCIRQTST_RecoverCorrupted 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_RecoverCorrupted 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 2  -- FAIL \n");
+    }
+
+    /* The recovered queue must continue to work and must overwrite the corrupted copy */
+    if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_InsertData(&l_tCtxRec, l_auData, sizeof(l_auData)) )
+    {
+        if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RecoverCtx(&l_tCtx, l_auMem, sizeof(l_auMem)) )
+        {
+            (void)printf("eCU_PCIRQTST_RecoverCorrupted 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eCU_PCIRQTST_RecoverCorrupted 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 3  -- FAIL \n");
+    }
+
+    /* Both copies corrupted */
+    l_auMem[0u] ^= 0xFFu;
+    l_auMem[ECU_PCIRQ_HEADERL / 2u] ^= 0xFFu;
+
+    if( e_eCU_PCIRQ_RES_NOVALIDHEADER == eCU_PCIRQ_RecoverCtx(&l_tCtxRec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_RecoverCorrupted 4  -- FAIL \n");
+    }
+}
+
+static void eCU_PCIRQTST_Cycle(void)
+{
+    /* Local variable */
+    t_eCU_PCIRQ_Ctx l_tCtx;
+    uint8_t  l_auMem[ECU_PCIRQ_HEADERL + 7u];
+    uint8_t  l_auInsertData[5u] = {1u, 2u, 3u, 4u, 5u};
+    uint8_t  l_auRetriveData[5u];
+    bool_t   l_bTestOk = true;
+
+    (void)eCU_PCIRQ_InitCtx(&l_tCtx, l_auMem, sizeof(l_auMem));
+
+    for(uint32_t i = 0u; ( ( i <= 1000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_auInsertData[0u] = (uint8_t) i;
+
+        if( e_eCU_PCIRQ_RES_OK != eCU_PCIRQ_InsertData(&l_tCtx, l_auInsertData, sizeof(l_auInsertData) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Restart every time */
+        if( e_eCU_PCIRQ_RES_OK != eCU_PCIRQ_RecoverCtx(&l_tCtx, l_auMem, sizeof(l_auMem)) )
+        {
+            l_bTestOk = false;
+        }
+
+        if( e_eCU_PCIRQ_RES_OK == eCU_PCIRQ_RetriveData(&l_tCtx, l_auRetriveData, sizeof(l_auRetriveData) ) )
+        {
+            if( 0 != memcmp(l_auInsertData, l_auRetriveData, sizeof(l_auRetriveData) ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eCU_PCIRQTST_Cycle 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eCU_PCIRQTST_Cycle 1  -- FAIL \n");
+    }
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file